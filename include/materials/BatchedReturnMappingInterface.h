@@ -0,0 +1,31 @@
+#pragma once
+
+#include "MaterialProperty.h"
+#include "RankTwoTensor.h"
+#include "RankFourTensor.h"
+
+#include <vector>
+
+/**
+ * Interface of the stress updates that can solve the return mappings of all quadrature points of
+ * an element together, before ComputeBatchedMultipleInelasticStress passes the quadrature points
+ * to updateState() one at a time.
+ */
+class BatchedReturnMappingInterface
+{
+public:
+  virtual ~BatchedReturnMappingInterface() = default;
+
+  /**
+   * Solve the return mappings of the quadrature points of the current element in one batch. Each
+   * quadrature point takes its batch solution in updateState() if the trial state it is called
+   * with matches the one given here, and solves its return mapping itself otherwise.
+   * @param trial_stress elastic trial stress of every quadrature point
+   * @param stress_old stress at the start of the step of every quadrature point, undamaged if a
+   * damage model is used
+   * @param elasticity_tensor elasticity tensor of the quadrature points
+   */
+  virtual void solveElementBatch(const std::vector<RankTwoTensor> & trial_stress,
+                                 const std::vector<RankTwoTensor> & stress_old,
+                                 const MaterialProperty<RankFourTensor> & elasticity_tensor) = 0;
+};
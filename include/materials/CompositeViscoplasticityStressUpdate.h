@@ -0,0 +1,65 @@
+#pragma once
+
+#include "ViscoplasticityStressUpdateFunction.h"
+
+#include <array>
+
+/**
+ * CompositeViscoplasticityStressUpdate combines the sinh, Perzyna and Peric viscoplastic flow
+ * laws and a power law creep term in a single isotropic radial return. The constitutive equation
+ * for the scalar inelastic strain rate is the sum of the rates of the active mechanisms,
+ * /f$ \dot{p} = \sum_i \phi_i (\sigma_e , r + \sigma_y) f/$, see
+ * ViscoplasticFlowLaws::CompositeFlow, so all mechanisms are solved by one scalar Newton iteration
+ * instead of the iteration between separate stress updates of ComputeMultipleInelasticStress.
+ *
+ * The converged increment is split between the mechanisms in proportion to their rates at the end
+ * of the step, and the effective strain of every active mechanism is stored as
+ * effective_<mechanism>_strain. All mechanisms harden with the total effective inelastic strain.
+ *
+ * The creep coefficient follows the Arrhenius law \f$ A e^{-Q / (R T)} \f$ when
+ * creep_activation_energy is nonzero; the other mechanisms have constant coefficients. The yield
+ * stress and the hardening function default to zero, so a creep-only model needs neither.
+ */
+template <bool is_ad>
+class CompositeViscoplasticityStressUpdateTempl
+  : public ViscoplasticityStressUpdateFunctionTempl<is_ad, ViscoplasticFlowLaws::CompositeFlow>
+{
+public:
+  static InputParameters validParams();
+
+  CompositeViscoplasticityStressUpdateTempl(const InputParameters & parameters);
+
+  using Material::_qp;
+
+protected:
+  virtual void initQpStatefulProperties() override;
+  virtual void computeQpCoefficients() override;
+  virtual void computeQpCoefficientParameters() override;
+  virtual void propagateQpStatefulProperties() override;
+
+  virtual void
+  computeStressFinalize(const GenericRankTwoTensor<is_ad> & plasticStrainIncrement) override;
+
+  static constexpr unsigned int num_mechanisms =
+      ViscoplasticFlowLaws::CompositeFlow::num_mechanisms;
+
+  /// Names of the mechanisms, in the order of ViscoplasticFlowLaws::CompositeFlow::rates()
+  static const std::array<std::string, num_mechanisms> _mechanism_names;
+
+  ///@{ Power law creep coefficient at the reference state and its Arrhenius parameters
+  const Real _creep_coefficient;
+  const Real _creep_activation_energy;
+  const Real _gas_constant;
+  ///@}
+
+  /// Temperature for the creep activation energy, nullptr if not coupled
+  const GenericVariableValue<is_ad> * const _temperature;
+
+  ///@{ Effective strain of every mechanism and its old value, nullptr for inactive mechanisms
+  std::array<MaterialProperty<Real> *, num_mechanisms> _mechanism_strain;
+  std::array<const MaterialProperty<Real> *, num_mechanisms> _mechanism_strain_old;
+  ///@}
+};
+
+typedef CompositeViscoplasticityStressUpdateTempl<false> CompositeViscoplasticityStressUpdate;
+typedef CompositeViscoplasticityStressUpdateTempl<true> ADCompositeViscoplasticityStressUpdate;
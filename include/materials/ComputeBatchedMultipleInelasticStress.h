@@ -0,0 +1,41 @@
+#pragma once
+
+#include "ComputeMultipleInelasticStress.h"
+
+class BatchedReturnMappingInterface;
+
+/**
+ * ComputeBatchedMultipleInelasticStress is ComputeMultipleInelasticStress with a single inelastic
+ * model that solves the return mappings of an element together, see
+ * BatchedReturnMappingInterface. Before the quadrature points of an element are updated one at a
+ * time, it computes their elastic trial stresses the same way the single model update does and
+ * passes them to the model, which solves its plastic quadrature points as one batch. The update
+ * of each quadrature point then only hands over the batch increment.
+ *
+ * The trial stress of a damaged material with finite strain rotations and an elasticity tensor
+ * that is not guaranteed to be isotropic is not predicted. Such elements, and quadrature points
+ * whose trial stress does not match its prediction, are solved one quadrature point at a time.
+ */
+class ComputeBatchedMultipleInelasticStress : public ComputeMultipleInelasticStress
+{
+public:
+  static InputParameters validParams();
+
+  ComputeBatchedMultipleInelasticStress(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+
+protected:
+  virtual void computeProperties() override;
+
+  /// Elastic trial stress the single model update passes to the model at the current qp
+  RankTwoTensor trialStress() const;
+
+  /// The inelastic model, which solves the batch
+  BatchedReturnMappingInterface * _batched_model;
+
+  ///@{ Trial and old stresses of the quadrature points of the current element
+  std::vector<RankTwoTensor> _trial_stress;
+  std::vector<RankTwoTensor> _batch_stress_old;
+  ///@}
+};
@@ -1,6 +1,7 @@
 #pragma once
 
-#include "RadialReturnStressUpdate.h"
+#include "ViscoplasticityStressUpdateBase.h"
+#include "TemperatureParameterTable.h"
 
 /**
  * This class uses the Discrete material in an isotropic radial return hyperbolic
@@ -15,61 +16,56 @@
  * This class is based on the implicit integration algorithm in F. Dunne and N.
  * Petrinic's Introduction to Computational Plasticity (2004) Oxford University
  * Press, pg. 162 - 163.
- * 
- * Expanded to permit function-based strain hardening rather than linear hardening.
- * Basing chages on IsotropicPlasticityStressUpdate approach, which also derives
- * from Dunne & Petrinic.
+ *
+ * Strain hardening follows the Voce model, with all parameters given as material properties that
+ * may vary spatially with temperature. The AD stress update takes AD properties and includes their
+ * derivatives in the increment. Alternatively all six parameters are interpolated together
+ * from a TemperatureParameterTable at a coupled temperature, which replaces the six upstream
+ * materials with a single packed lookup. The AD stress update then includes the temperature
+ * derivative of the increment, from the interval slopes of the piecewise linear table and the
+ * derivatives of the converged residual with respect to the parameters.
  */
-class HSVStressUpdate : public RadialReturnStressUpdate
+template <bool is_ad>
+class HSVStressUpdateTempl
+  : public ViscoplasticityStressUpdateBaseTempl<is_ad,
+                                                ViscoplasticFlowLaws::SinhFlow,
+                                                ViscoplasticHardeningLaws::VoceHardening>
 {
 public:
   static InputParameters validParams();
 
-  HSVStressUpdate(const InputParameters & parameters);
+  HSVStressUpdateTempl(const InputParameters & parameters);
+
+  using Material::_qp;
 
 protected:
-  virtual void initQpStatefulProperties() override;
-  virtual void propagateQpStatefulProperties() override;
+  virtual void computeQpCoefficients() override;
+  virtual void computeQpCoefficientParameters() override;
 
-  virtual void computeStressInitialize(const Real & effective_trial_stress,
-                                       const RankFourTensor & elasticity_tensor) override;
-  virtual Real computeResidual(const Real & effective_trial_stress, const Real & scalar) override;
-  virtual Real computeDerivative(const Real & effective_trial_stress, const Real & scalar) override;
-  virtual void iterationFinalize(const Real & scalar) override;
-  virtual void computeStressFinalize(const RankTwoTensor & plasticStrainIncrement) override;
-  virtual Real computeHardeningValue(Real scalar);
-  virtual Real computeHardeningDerivative(Real scalar); // Added. 
+  /// The material property named by param, or nullptr if the parameters come from the table
+  const GenericMaterialProperty<Real, is_ad> * getParameterProperty(const std::string & param);
 
-  /// a string to prepend to the plastic strain Material Property name
-  const std::string _plastic_prepend;
+  /// Build _parameter_table from the table_* parameters
+  void buildParameterTable();
+
+  /// Temperature the parameter table is evaluated at, nullptr if the properties are used
+  const GenericVariableValue<is_ad> * const _temperature;
 
   ///@{ Strain hardening parameters
-  const MaterialProperty<Real> & _yield_stress; // Material property now
-  const MaterialProperty<Real> & _sat_stress; // Hard coded voce now 
-  const MaterialProperty<Real> & _exp_rate;
-  const MaterialProperty<Real> & _lin_rate;
-  Real _hardening_slope; // Added, stores current gradient of function
+  const GenericMaterialProperty<Real, is_ad> * const _yield_stress;
+  const GenericMaterialProperty<Real, is_ad> * const _sat_stress;
+  const GenericMaterialProperty<Real, is_ad> * const _exp_rate;
+  const GenericMaterialProperty<Real, is_ad> * const _lin_rate;
   ///@}
 
   ///@{ Viscoplasticity constitutive equation parameters
-  const MaterialProperty<Real> & _c_alpha;
-  const MaterialProperty<Real> & _c_beta;
+  const GenericMaterialProperty<Real, is_ad> * const _c_alpha;
+  const GenericMaterialProperty<Real, is_ad> * const _c_beta;
   ///@}
 
-  /// Elastic properties
-  Real _yield_condition;
-
-  ///@{ Viscoplasticity terms corresponding to Dunne and Petrinic eqn 5.64
-  Real _xphir;
-  Real _xphidp;
-  ///@}
-
-  MaterialProperty<Real> & _hardening_variable;
-  const MaterialProperty<Real> & _hardening_variable_old;
-
-  /// plastic strain of this model
-  MaterialProperty<RankTwoTensor> & _plastic_strain;
+  /// Packed yield_stress, sat_stress, exp_rate, lin_rate, c_alpha and c_beta over temperature
+  std::unique_ptr<const TemperatureParameterTable> _parameter_table;
+};
 
-  /// old value of plastic strain
-  const MaterialProperty<RankTwoTensor> & _plastic_strain_old;
-};
\ No newline at end of file
+typedef HSVStressUpdateTempl<false> HSVStressUpdate;
+typedef HSVStressUpdateTempl<true> ADHSVStressUpdate;
@@ -2,6 +2,15 @@
 
 #include "ScalarDamageBase.h"
 
+/**
+ * Kachanov-Rabotnov creep damage \f$ \dot{D} = (\sigma_{vm} / a)^\zeta (1 - D)^{-\phi} \f$.
+ *
+ * The damage is integrated in closed form over each time step at the current stress, see
+ * KRDamageLaw, so large steps far from rupture remain accurate. A step in which the material
+ * would rupture throws a MooseException so that the time step is cut back, and
+ * computeTimeStepLimit limits the step to the time in which the damage grows by
+ * maximum_damage_increment.
+ */
 template <bool is_ad>
 class KRDamageTempl : public ScalarDamageBaseTempl<is_ad>
 {
@@ -10,9 +19,14 @@ public:
 
   KRDamageTempl(const InputParameters & parameters);
 
+  virtual Real computeTimeStepLimit() override;
+
 protected:
   virtual void updateQpDamageIndex() override;
 
+  /// von Mises stress of the current quadrature point
+  GenericReal<is_ad> effectiveStress() const;
+
   ///@{ Material properties for the damage model.
   const Real _a;
   const Real _phi;
@@ -31,7 +45,8 @@ protected:
   using ScalarDamageBaseTempl<is_ad>::_damage_index_old;
   using ScalarDamageBaseTempl<is_ad>::_base_name;
   using ScalarDamageBaseTempl<is_ad>::_damage_index_name;
+  using ScalarDamageBaseTempl<is_ad>::_maximum_damage_increment;
 };
 
 typedef KRDamageTempl<false> KRDamage;
-typedef KRDamageTempl<true> ADKRDamage;
\ No newline at end of file
+typedef KRDamageTempl<true> ADKRDamage;
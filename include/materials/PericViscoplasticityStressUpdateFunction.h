@@ -1,73 +1,36 @@
 #pragma once
 
-#include "RadialReturnStressUpdate.h"
+#include "ViscoplasticityStressUpdateFunction.h"
 
 /**
- * This class uses the Discrete material in an isotropic radial return hyperbolic
- * sine viscoplasticity model.
+ * This class uses the Discrete material in an isotropic radial return Peric type
+ * viscoplasticity model.
  *
  * This class inherits from RadialReturnStressUpdate and must be used
  * in conjunction with ComputeReturnMappingStress. This uniaxial viscoplasticity
  * class computes the plastic strain as a stateful material property.  The
  * constitutive equation for scalar plastic strain rate used in this model is
- * /f$ \dot{p} = \phi (\sigma_e , r) = \alpha sinh \beta (\sigma_e -r - \sigma_y) f/$
+ * /f$ \dot{p} = \phi (\sigma_e , r) = \eta ((\sigma_e / (r + \sigma_y))^n - 1) f/$
  *
  * This class is based on the implicit integration algorithm in F. Dunne and N.
  * Petrinic's Introduction to Computational Plasticity (2004) Oxford University
  * Press, pg. 162 - 163.
- * 
+ *
  * Expanded to permit function-based strain hardening rather than linear hardening.
  * Basing chages on IsotropicPlasticityStressUpdate approach, which also derives
  * from Dunne & Petrinic.
  */
-class PericViscoplasticityStressUpdateFunction : public RadialReturnStressUpdate
+template <bool is_ad>
+class PericViscoplasticityStressUpdateFunctionTempl
+  : public ViscoplasticityStressUpdateFunctionTempl<is_ad, ViscoplasticFlowLaws::PericFlow>
 {
 public:
   static InputParameters validParams();
 
-  PericViscoplasticityStressUpdateFunction(const InputParameters & parameters);
-
-protected:
-  virtual void initQpStatefulProperties() override;
-  virtual void propagateQpStatefulProperties() override;
-
-  virtual void computeStressInitialize(const Real & effective_trial_stress,
-                                       const RankFourTensor & elasticity_tensor) override;
-  virtual Real computeResidual(const Real & effective_trial_stress, const Real & scalar) override;
-  virtual Real computeDerivative(const Real & effective_trial_stress, const Real & scalar) override;
-  virtual void iterationFinalize(const Real & scalar) override;
-  virtual void computeStressFinalize(const RankTwoTensor & plasticStrainIncrement) override;
-  virtual Real computeHardeningValue(Real scalar);
-  virtual Real computeHardeningDerivative(Real scalar); // Added. 
-
-  /// a string to prepend to the plastic strain Material Property name
-  const std::string _plastic_prepend;
-
-  ///@{ Strain hardening parameters
-  const Real _yield_stress; //Constant for now, but in IsotropicPlasticityStressUpdate it can be a function of temperature.
-  const Function & _hardening_function; // Modified to function.
-  Real _hardening_slope; // Added, stores current gradient of function
-  ///@}
-
-  ///@{ Viscoplasticity constitutive equation parameters
-  const Real _n;
-  const Real _eta;
-  ///@}
-
-  /// Elastic properties
-  Real _yield_condition;
-
-  ///@{ Viscoplasticity terms corresponding to Dunne and Petrinic eqn 5.64
-  Real _xphir;
-  Real _xphidp;
-  ///@}
-
-  MaterialProperty<Real> & _hardening_variable;
-  const MaterialProperty<Real> & _hardening_variable_old;
-
-  /// plastic strain of this model
-  MaterialProperty<RankTwoTensor> & _plastic_strain;
+  PericViscoplasticityStressUpdateFunctionTempl(const InputParameters & parameters);
+};
 
-  /// old value of plastic strain
-  const MaterialProperty<RankTwoTensor> & _plastic_strain_old;
-};
\ No newline at end of file
+typedef PericViscoplasticityStressUpdateFunctionTempl<false>
+    PericViscoplasticityStressUpdateFunction;
+typedef PericViscoplasticityStressUpdateFunctionTempl<true>
+    ADPericViscoplasticityStressUpdateFunction;
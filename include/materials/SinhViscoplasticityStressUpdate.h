@@ -1,6 +1,6 @@
 #pragma once
 
-#include "RadialReturnStressUpdate.h"
+#include "ViscoplasticityStressUpdateFunction.h"
 
 /**
  * This class uses the Discrete material in an isotropic radial return hyperbolic
@@ -21,71 +21,14 @@
  * from Dunne & Petrinic.
  */
 template <bool is_ad>
-class SinhViscoplasticityStressUpdateTempl : public RadialReturnStressUpdateTempl<is_ad>
+class SinhViscoplasticityStressUpdateTempl
+  : public ViscoplasticityStressUpdateFunctionTempl<is_ad, ViscoplasticFlowLaws::SinhFlow>
 {
 public:
   static InputParameters validParams();
 
   SinhViscoplasticityStressUpdateTempl(const InputParameters & parameters);
-
-  using Material::_qp;
-  using RadialReturnStressUpdateTempl<is_ad>::_base_name;
-  using RadialReturnStressUpdateTempl<is_ad>::_three_shear_modulus;
-  using RadialReturnStressUpdateTempl<is_ad>::_dt;
-
-protected:
-  virtual void initQpStatefulProperties() override;
-  virtual void propagateQpStatefulProperties() override;
-
-  virtual void
-  computeStressInitialize(const GenericReal<is_ad> & effective_trial_stress,
-                          const GenericRankFourTensor<is_ad> & elasticity_tensor) override;
-  virtual GenericReal<is_ad> computeResidual(const GenericReal<is_ad> & effective_trial_stress,
-                                             const GenericReal<is_ad> & scalar) override;
-  virtual GenericReal<is_ad> computeDerivative(const GenericReal<is_ad> & effective_trial_stress,
-                                               const GenericReal<is_ad> & scalar) override;
-  virtual void iterationFinalize(const GenericReal<is_ad> & scalar) override;
-  virtual void
-  computeStressFinalize(const GenericRankTwoTensor<is_ad> & plasticStrainIncrement) override;
-  virtual GenericReal<is_ad> computeHardeningValue(const GenericReal<is_ad> & scalar);
-  virtual GenericReal<is_ad> computeHardeningDerivative(const GenericReal<is_ad> & scalar);
-
-  /// a string to prepend to the plastic strain Material Property name
-  const std::string _plastic_prepend;
-
-  ///@{ Strain hardening parameters
-  const Real _yield_stress; // Constant for now, but in IsotropicPlasticityStressUpdate it can be a
-  // function of temperature.
-  const Function * const _hardening_function; // Modified to function.
-  GenericReal<is_ad> _hardening_slope;        // Added, stores current gradient of function
-  ///@}
-
-  ///@{ Viscoplasticity constitutive equation parameters
-  const Real _alpha;
-  const Real _beta;
-  ///@}
-
-  /// Elastic properties
-  GenericReal<is_ad> _yield_condition;
-
-  ///@{ Viscoplasticity terms corresponding to Dunne and Petrinic eqn 5.64
-  GenericReal<is_ad> _xphir;
-  GenericReal<is_ad> _xphidp;
-  ///@}
-
-  GenericMaterialProperty<Real, is_ad> & _hardening_variable;
-  const MaterialProperty<Real> & _hardening_variable_old;
-
-  /// plastic strain of this model
-  GenericMaterialProperty<RankTwoTensor, is_ad> & _plastic_strain;
-
-  /// old value of plastic strain
-  const MaterialProperty<RankTwoTensor> & _plastic_strain_old;
-
-  std::vector<GenericMaterialProperty<Real, is_ad> *> _properties;
 };
 
-typedef SinhViscoplasticityStressUpdateTempl<false>
-    SinhViscoplasticityStressUpdate;
-typedef SinhViscoplasticityStressUpdateTempl<true>
-    ADSinhViscoplasticityStressUpdate;
\ No newline at end of file
+typedef SinhViscoplasticityStressUpdateTempl<false> SinhViscoplasticityStressUpdate;
+typedef SinhViscoplasticityStressUpdateTempl<true> ADSinhViscoplasticityStressUpdate;
@@ -0,0 +1,379 @@
+#pragma once
+
+#include "RadialReturnStressUpdate.h"
+#include "BatchedReturnMappingInterface.h"
+#include "ViscoplasticFlowLaws.h"
+#include "ViscoplasticHardeningLaws.h"
+#include "ViscoplasticReturnMapping.h"
+#include "ViscoplasticReturnMappingBatch.h"
+
+#include <unordered_map>
+#include <vector>
+
+class ReturnMappingStatistics;
+
+/**
+ * ViscoplasticityStressUpdateBase is the common isotropic radial return viscoplasticity model of
+ * the sloth stress updates. The constitutive equation for the scalar plastic strain rate is
+ * /f$ \dot{p} = \phi (\sigma_e , \sigma_y + r) f/$, integrated implicitly following F. Dunne and
+ * N. Petrinic's Introduction to Computational Plasticity (2004) Oxford University Press,
+ * pg. 162 - 163.
+ *
+ * The flow law \f$ \phi \f$ and the hardening law \f$ r(p) \f$ are compile time policies, see
+ * ViscoplasticFlowLaws and ViscoplasticHardeningLaws, so that every combination is compiled into
+ * its own residual evaluation without virtual calls inside the return mapping iterations.
+ * Derived classes only declare their parameters and gather the policy coefficients of the current
+ * quadrature point in computeQpCoefficients().
+ *
+ * With robust_integration the increment is solved up front by a ViscoplasticReturnMapping, on the
+ * bounded residual of the flow law where available and with local substepping, and handed to the
+ * MOOSE return mapping as its initial guess, which then converges on the first residual evaluation.
+ * The substeps ramp the stress linearly from the old to the trial stress, and the derivatives of
+ * the summed increment are chained through them. The Real tangent only takes the derivative with
+ * respect to the von Mises trial stress, the AD derivatives also follow the trial direction.
+ * With an explicit_tolerance, every plastic quadrature point first tries a single linearized
+ * implicit step, handed over the same way, and only falls back to the full return mapping if the
+ * local error estimate of that step exceeds the tolerance.
+ *
+ * With implicit_differentiation the AD stress updates solve the increment in Real, with the plain
+ * or the robust local return mapping, and attach the derivatives of the trial state to the
+ * converged increment once through the implicit function theorem, instead of carrying them through
+ * every iteration. AD stress updates whose coefficients depend on coupled quantities with AD
+ * derivatives, such as a coupled temperature, always take this path, since Real coefficients cannot
+ * carry those derivatives. The derivatives of the increment along the coefficient changes come from
+ * the same implicit function theorem on the converged residual, see
+ * computeQpCoefficientParameters().
+ *
+ * With cache_return_mapping every quadrature point keeps the inputs and the solution of its last
+ * plastic return mapping. Repeated material evaluations at the same trial state, as in the
+ * residual and Jacobian evaluations of a nonlinear iteration, reuse the increment and its tangent.
+ *
+ * Used with ComputeBatchedMultipleInelasticStress, the non-AD stress updates solve the plastic
+ * quadrature points of an element in one ViscoplasticReturnMappingBatch before the quadrature
+ * points are passed to updateState(), which then hands the batch increment over like a robust one.
+ * Points that are elastic, hit the cache, take the explicit step or fail to converge in the batch
+ * are left to their usual path.
+ *
+ * This class inherits from RadialReturnStressUpdate and must be used in conjunction with
+ * ComputeMultipleInelasticStress.
+ */
+template <bool is_ad, typename FlowLaw, typename Hardening>
+class ViscoplasticityStressUpdateBaseTempl : public RadialReturnStressUpdateTempl<is_ad>,
+                                             public BatchedReturnMappingInterface
+{
+public:
+  static InputParameters validParams();
+
+  ViscoplasticityStressUpdateBaseTempl(const InputParameters & parameters);
+
+  using Material::_qp;
+  using RadialReturnStressUpdateTempl<is_ad>::_base_name;
+  using RadialReturnStressUpdateTempl<is_ad>::_three_shear_modulus;
+  using RadialReturnStressUpdateTempl<is_ad>::_dt;
+
+  /// Records failed return mapping solves before passing the failure on, and gives accepted
+  /// explicit steps the elastic tangent
+  virtual void updateState(GenericRankTwoTensor<is_ad> & strain_increment,
+                           GenericRankTwoTensor<is_ad> & inelastic_strain_increment,
+                           const GenericRankTwoTensor<is_ad> & rotation_increment,
+                           GenericRankTwoTensor<is_ad> & stress_new,
+                           const RankTwoTensor & stress_old,
+                           const GenericRankFourTensor<is_ad> & elasticity_tensor,
+                           const RankTwoTensor & elastic_strain_old,
+                           bool compute_full_tangent_operator,
+                           RankFourTensor & tangent_operator) override;
+
+  /// Drops the cached solutions of the previous step
+  virtual void timestepSetup() override;
+
+  /// Solve the plastic quadrature points of the current element together, non-AD only
+  virtual void
+  solveElementBatch(const std::vector<RankTwoTensor> & trial_stress,
+                    const std::vector<RankTwoTensor> & stress_old,
+                    const MaterialProperty<RankFourTensor> & elasticity_tensor) override;
+
+protected:
+  virtual void initQpStatefulProperties() override;
+  virtual void propagateQpStatefulProperties() override;
+
+  virtual void
+  computeStressInitialize(const GenericReal<is_ad> & effective_trial_stress,
+                          const GenericRankFourTensor<is_ad> & elasticity_tensor) override;
+  virtual GenericReal<is_ad>
+  initialGuess(const GenericReal<is_ad> & effective_trial_stress) override;
+  virtual GenericReal<is_ad> computeResidual(const GenericReal<is_ad> & effective_trial_stress,
+                                             const GenericReal<is_ad> & scalar) override;
+  virtual GenericReal<is_ad> computeDerivative(const GenericReal<is_ad> & effective_trial_stress,
+                                               const GenericReal<is_ad> & scalar) override;
+  virtual void iterationFinalize(const GenericReal<is_ad> & scalar) override;
+  virtual Real computeStressDerivative(const Real effective_trial_stress,
+                                       const Real scalar) override;
+  virtual void
+  computeStressFinalize(const GenericRankTwoTensor<is_ad> & plasticStrainIncrement) override;
+
+  /**
+   * Set _qp_yield_stress, _flow_coefficients and _hardening_coefficients for the current quadrature
+   * point. Called once per quadrature point before the return mapping.
+   */
+  virtual void computeQpCoefficients() = 0;
+
+  /// Change of the coefficients with a quantity they depend on
+  typedef typename ViscoplasticReturnMapping<Real, FlowLaw, Hardening>::CoefficientDerivatives
+      CoefficientDerivatives;
+
+  /**
+   * Add a coefficient parameter with addCoefficientParameter() for every coupled quantity with AD
+   * derivatives the coefficients of the current quadrature point depend on. Only called for AD
+   * stress updates at plastic quadrature points, after computeQpCoefficients().
+   */
+  virtual void computeQpCoefficientParameters() {}
+
+  /**
+   * Attach the AD derivatives of parameter to the increment, through the derivatives of the
+   * coefficients of the current quadrature point with respect to it. Parameters without AD
+   * derivatives are skipped.
+   */
+  void addCoefficientParameter(const GenericReal<is_ad> & parameter,
+                               const CoefficientDerivatives & derivatives);
+
+  /// Whether the coefficients of the current quadrature point carry AD derivatives
+  bool coefficientDerivatives() const { return !_coefficient_perturbations.empty(); }
+
+  /**
+   * Sum of the coefficient parameter deviations, which carry their AD derivatives, times the
+   * given derivatives of the increment with respect to the parameters
+   */
+  GenericReal<is_ad> coefficientPerturbation(const std::vector<Real> & dscalar_dparameters) const;
+
+  /// Set the start and the path of the substepping ramp from the old and the trial stress
+  void computeStressPath(const RankTwoTensor & stress_old,
+                         const GenericRankTwoTensor<is_ad> & trial_stress);
+
+  /**
+   * Hand the batch increment of the current quadrature point over to the MOOSE return mapping,
+   * returns false if the point was not solved in the batch from the same trial state
+   */
+  bool takeBatchIncrement();
+
+  /// Solve the increment of the current quadrature point with the robust return mapping
+  void computeRobustIncrement(const GenericReal<is_ad> & effective_trial_stress);
+
+  /// Plastic strain rate of the previous step to extrapolate the initial guess from, or zero
+  Real extrapolatedRate() const;
+
+  /// Hardening value at the start of the step, stored or recomputed from the coefficients
+  Real hardeningOld() const;
+
+  /// Reset the plastic strain to its old value in whichever form it is stored
+  void resetQpPlasticStrain();
+
+  /**
+   * Try the error controlled explicit step of the current quadrature point, returns whether it was
+   * accepted
+   */
+  bool computeExplicitIncrement(const GenericReal<is_ad> & effective_trial_stress);
+
+  /**
+   * Solve the increment of the current quadrature point in Real and attach the derivatives of the
+   * effective trial stress and the shear modulus through the implicit function theorem
+   */
+  void computeDifferentiatedIncrement(const GenericReal<is_ad> & effective_trial_stress);
+
+  /**
+   * Hand the increment scalar over to the MOOSE return mapping, with the derivatives of the trial
+   * state attached through its derivatives with respect to the effective trial stress, the
+   * projected old stress, three times the shear modulus and the coefficient parameters
+   */
+  void setPrecomputedIncrement(const GenericReal<is_ad> & effective_trial_stress,
+                               const Real scalar,
+                               const Real dscalar_dtrial_stress,
+                               const Real dscalar_dprojected_stress,
+                               const Real dscalar_dthree_shear_modulus,
+                               const std::vector<Real> & dscalar_dparameters);
+
+  /// Derivative of the increment scalar with respect to the effective trial stress
+  Real incrementStressDerivative(const Real effective_trial_stress, const Real scalar) const;
+
+  /// Inputs and solution of the last plastic return mapping of a quadrature point
+  struct CacheEntry
+  {
+    bool valid = false;
+    Real effective_trial_stress;
+    Real three_shear_modulus;
+    Real strain_old;
+    Real hardening_old;
+    Real dt;
+    Real effective_stress_old;
+    Real projected_stress_old;
+    Real yield_stress;
+    typename FlowLaw::Coefficients flow;
+    typename Hardening::Coefficients hardening_law;
+    Real scalar;
+    Real dscalar_dtrial_stress;
+    Real dscalar_dprojected_stress;
+    Real dscalar_dthree_shear_modulus;
+    std::vector<Real> dscalar_dparameters;
+  };
+
+  /// Cache entry of the current quadrature point, created on first use
+  CacheEntry & qpCacheEntry();
+
+  /// Whether entry was solved from the given inputs within the cache tolerance
+  bool cacheMatches(const CacheEntry & entry,
+                    const Real effective_trial_stress,
+                    const Real three_shear_modulus,
+                    const Real strain_old,
+                    const Real hardening_old) const;
+
+  /// Pass the coefficients of the current quadrature point to a local return mapping
+  template <typename T>
+  void setupLocalReturnMapping(ViscoplasticReturnMapping<T, FlowLaw, Hardening> & return_mapping);
+
+  /// a string to prepend to the plastic strain Material Property name
+  const std::string _plastic_prepend;
+
+  ///@{ Coefficients of the current quadrature point
+  Real _qp_yield_stress;
+  typename FlowLaw::Coefficients _flow_coefficients;
+  typename Hardening::Coefficients _hardening_coefficients;
+  ///@}
+
+  /// Elastic properties
+  GenericReal<is_ad> _yield_condition;
+
+  /// Hardening value and slope at the current iterate
+  GenericReal<is_ad> _hardening_value;
+  GenericReal<is_ad> _hardening_slope;
+
+  /// Derivative of the residual at the current iterate, computed together with the residual
+  GenericReal<is_ad> _residual_derivative;
+
+  /// How the plastic strain of this model is stored
+  enum class PlasticStrainStorage
+  {
+    FULL,
+    SYMMETRIC,
+    NONE
+  };
+  const PlasticStrainStorage _plastic_strain_storage;
+
+  GenericMaterialProperty<Real, is_ad> & _hardening_variable;
+
+  /// old hardening variable, nullptr if it is recomputed from the old effective plastic strain
+  const MaterialProperty<Real> * const _hardening_variable_old;
+
+  ///@{ plastic strain of this model and its old value, only set for FULL storage
+  GenericMaterialProperty<RankTwoTensor, is_ad> * const _plastic_strain;
+  const MaterialProperty<RankTwoTensor> * const _plastic_strain_old;
+  ///@}
+
+  ///@{ plastic strain of this model and its old value, only set for SYMMETRIC storage, declared as
+  /// symmetric_plastic_strain so that consumers of the RankTwoTensor plastic_strain cannot read its
+  /// Mandel components by accident
+  GenericMaterialProperty<SymmetricRankTwoTensor, is_ad> * const _symmetric_plastic_strain;
+  const MaterialProperty<SymmetricRankTwoTensor> * const _symmetric_plastic_strain_old;
+  ///@}
+
+  /// Optional collector of the local solver statistics
+  const ReturnMappingStatistics * const _statistics;
+
+  /// Residual evaluations of the current return mapping solve, one more than the iterations
+  unsigned int _residual_evaluations;
+
+  /// Residual of the last evaluation
+  Real _last_residual;
+
+  /// Whether the increment is solved up front by _local_return_mapping
+  const bool _robust_integration;
+
+  /// Largest accepted local error estimate of the explicit step, zero if it is not attempted
+  const Real _explicit_tolerance;
+
+  /// Safeguarded, substepping return mapping of the robust integration and the explicit step
+  ViscoplasticReturnMapping<GenericReal<is_ad>, FlowLaw, Hardening> _local_return_mapping;
+
+  /// Whether AD increments are solved in Real and differentiated once, always false without AD
+  const bool _implicit_differentiation;
+
+  /// Return mapping of the implicit differentiation, plain or robust
+  ViscoplasticReturnMapping<Real, FlowLaw, Hardening> _real_return_mapping;
+
+  /// von Mises stress at the start of the step, the start of the substepping ramp
+  Real _effective_stress_old;
+
+  /// Old deviatoric stress projected onto the trial direction, which sets the path of the ramp
+  GenericReal<is_ad> _projected_stress_old;
+
+  ///@{ Increment and hardening value solved before the MOOSE return mapping
+  GenericReal<is_ad> _precomputed_increment;
+  GenericReal<is_ad> _precomputed_hardening;
+  ///@}
+
+  /// Whether the current quadrature point was solved before the MOOSE return mapping
+  bool _precomputed_step;
+
+  /// von Mises stress of the elastic trial state of the current quadrature point
+  Real _effective_trial_stress;
+
+  /// Whether to reuse the return mapping solution of an identical trial state
+  const bool _cache_return_mapping;
+
+  /// Relative tolerance within which the inputs of a cached solution have to match
+  const Real _cache_tolerance;
+
+  /**
+   * Cached solutions by element id and quadrature point, each thread owns its own copy. Cleared
+   * every time step, so it never holds more than the current step and element ids renumbered by
+   * a mesh change between steps cannot match.
+   */
+  std::unordered_map<dof_id_type, std::vector<CacheEntry>> _cache;
+
+  /// Whether the current quadrature point reused a cached solution
+  bool _cache_hit;
+
+  /// Derivative of the current increment with respect to the effective trial stress, once known
+  Real _stress_derivative;
+  bool _stress_derivative_known;
+
+  /**
+   * Deviations of the coefficient parameters of the current quadrature point, which carry their AD
+   * derivatives. The coefficient derivatives are held by _real_return_mapping.
+   */
+  std::vector<GenericReal<is_ad>> _coefficient_perturbations;
+
+  /// Derivatives of the current increment with respect to the coefficient parameters
+  std::vector<Real> _dscalar_dparameters;
+
+  /// Plastic quadrature points of the current element solved by solveElementBatch()
+  ViscoplasticReturnMappingBatch<FlowLaw, Hardening> _batch;
+
+  /// Trial state a quadrature point was added to the batch with
+  struct BatchPoint
+  {
+    bool valid = false;
+    std::size_t index;
+    Real effective_trial_stress;
+    Real three_shear_modulus;
+  };
+
+  /// Batch points of the quadrature points of _batch_elem, each taken at most once
+  std::vector<BatchPoint> _batch_points;
+  dof_id_type _batch_elem;
+
+  /// Whether the current quadrature point took its increment from the batch
+  bool _batch_step;
+
+  /// Local iterations of the increment solved before the MOOSE return mapping
+  unsigned int _precomputed_iterations;
+
+  /// Whether the current quadrature point was solved by the explicit step
+  bool _explicit_step;
+
+  /// Whether the return mapping starts from the plastic strain rate of the previous step
+  const bool _extrapolate_initial_guess;
+
+  ///@{ Effective plastic strain rate of the last converged step, only with an extrapolated guess
+  MaterialProperty<Real> * const _plastic_strain_rate;
+  const MaterialProperty<Real> * const _plastic_strain_rate_old;
+  ///@}
+};
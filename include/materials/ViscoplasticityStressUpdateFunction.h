@@ -0,0 +1,45 @@
+#pragma once
+
+#include "ViscoplasticityStressUpdateBase.h"
+
+/**
+ * ViscoplasticityStressUpdateFunction specializes ViscoplasticityStressUpdateBase to a constant
+ * yield stress and function based strain hardening, following the IsotropicPlasticityStressUpdate
+ * approach. The hardening function is evaluated at the quadrature point, as the Peric and
+ * Hyperbolic models always did; the Sinh and Perzyna models used to evaluate it at the origin.
+ * The hardening function can optionally be evaluated through a shared
+ * HardeningCurveTable, which samples it at the origin, so a tabulated function must not depend on
+ * position; this is checked at every quadrature point when the stateful properties are
+ * initialized. Derived classes set the constant _flow_coefficients of their flow law.
+ */
+template <bool is_ad, typename FlowLaw>
+class ViscoplasticityStressUpdateFunctionTempl
+  : public ViscoplasticityStressUpdateBaseTempl<is_ad,
+                                                FlowLaw,
+                                                ViscoplasticHardeningLaws::FunctionHardening>
+{
+public:
+  static InputParameters validParams();
+
+  ViscoplasticityStressUpdateFunctionTempl(const InputParameters & parameters);
+
+  using Material::_qp;
+
+  virtual void initialSetup() override;
+
+protected:
+  virtual void initQpStatefulProperties() override;
+  virtual void computeQpCoefficients() override;
+
+  ///@{ Strain hardening parameters
+  const Real _yield_stress; // Constant for now, but in IsotropicPlasticityStressUpdate it can be a
+  // function of temperature.
+  const Function & _hardening_function;
+
+  /// Whether to evaluate the hardening function through a shared table
+  const bool _tabulate_hardening_function;
+
+  /// Tabulated hardening function, only set if tabulate_hardening_function is true
+  std::shared_ptr<const HardeningCurveTable> _hardening_table;
+  ///@}
+};
@@ -0,0 +1,128 @@
+#pragma once
+
+#include "MooseTypes.h"
+#include "InputParameters.h"
+#include "metaphysicl/raw_type.h"
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+/**
+ * Monotone piecewise cubic Hermite (PCHIP) table of a hardening curve sampled on a uniform
+ * effective plastic strain grid. Each interval stores its four polynomial coefficients next to each
+ * other, so the hardening value and slope come out of a single contiguous lookup instead of a
+ * virtual Function::value() and Function::timeDerivative() call per Newton iteration.
+ *
+ * Tables are immutable once built and are shared through getTable() by every thread and block that
+ * tabulates the same function over the same range. The registry only holds weak references, so a
+ * table lives as long as the objects using it.
+ */
+class HardeningCurveTable
+{
+public:
+  /// Parameters controlling the optional tabulation of a hardening_function
+  static InputParameters validParams();
+
+  /**
+   * Sample the curve on intervals + 1 uniformly spaced points over [0, max_strain]
+   * @param curve hardening stress as a function of effective plastic strain
+   * @param max_strain upper end of the tabulated range, the curve is extrapolated linearly beyond
+   * @param intervals number of uniform intervals in the table
+   */
+  HardeningCurveTable(const std::function<Real(Real)> & curve,
+                      const Real max_strain,
+                      const unsigned int intervals);
+
+  /**
+   * Return the table registered under key, building it from curve on first use. The same table
+   * instance is handed out to every caller with a matching key while any of them still holds it,
+   * so the key only needs to be unique among the live users, e.g. within an application.
+   */
+  static std::shared_ptr<const HardeningCurveTable>
+  getTable(const std::string & key,
+           const std::function<Real(Real)> & curve,
+           const Real max_strain,
+           const unsigned int intervals);
+
+  /**
+   * Evaluate the hardening value and slope at the given effective plastic strain. For AD types the
+   * derivatives of strain are carried through using the local slope and curvature of the table.
+   */
+  template <typename T>
+  void evaluate(const T & strain, T & value, T & slope) const;
+
+  /// Upper end of the tabulated strain range
+  Real maxStrain() const { return _max_strain; }
+
+private:
+  /// Hardening value, slope and curvature at a raw strain value
+  void lookup(const Real strain, Real & value, Real & slope, Real & curvature) const;
+
+  const Real _max_strain;
+  const unsigned int _intervals;
+  const Real _spacing;
+  const Real _inverse_spacing;
+
+  /// Per interval coefficients of v(s) = c0 + s * (c1 + s * (c2 + s * c3)) with s = strain - x_i
+  std::vector<std::array<Real, 4>> _coefficients;
+};
+
+inline void
+HardeningCurveTable::lookup(const Real strain, Real & value, Real & slope, Real & curvature) const
+{
+  // Linear extrapolation with the end slopes outside of the tabulated range
+  if (strain <= 0.0)
+  {
+    const auto & c = _coefficients.front();
+    value = c[0] + c[1] * strain;
+    slope = c[1];
+    curvature = 0.0;
+    return;
+  }
+
+  if (strain >= _max_strain)
+  {
+    const auto & c = _coefficients.back();
+    const Real s = _spacing;
+    const Real end_value = c[0] + s * (c[1] + s * (c[2] + s * c[3]));
+    const Real end_slope = c[1] + s * (2.0 * c[2] + 3.0 * s * c[3]);
+    value = end_value + end_slope * (strain - _max_strain);
+    slope = end_slope;
+    curvature = 0.0;
+    return;
+  }
+
+  const unsigned int i =
+      std::min(static_cast<unsigned int>(strain * _inverse_spacing), _intervals - 1);
+  const Real s = strain - i * _spacing;
+  const auto & c = _coefficients[i];
+
+  value = c[0] + s * (c[1] + s * (c[2] + s * c[3]));
+  slope = c[1] + s * (2.0 * c[2] + 3.0 * s * c[3]);
+  curvature = 2.0 * c[2] + 6.0 * s * c[3];
+}
+
+template <typename T>
+void
+HardeningCurveTable::evaluate(const T & strain, T & value, T & slope) const
+{
+  Real raw_value, raw_slope, raw_curvature;
+  lookup(MetaPhysicL::raw_value(strain), raw_value, raw_slope, raw_curvature);
+
+  if constexpr (std::is_same<T, Real>::value)
+  {
+    value = raw_value;
+    slope = raw_slope;
+  }
+  else
+  {
+    // zero valued perturbation that only carries the derivatives of the strain
+    const T perturbation = strain - MetaPhysicL::raw_value(strain);
+    value = raw_value + raw_slope * perturbation;
+    slope = raw_slope + raw_curvature * perturbation;
+  }
+}
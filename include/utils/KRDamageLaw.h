@@ -0,0 +1,70 @@
+#pragma once
+
+#include "MooseTypes.h"
+#include "ViscoplasticFlowLaws.h"
+
+#include <algorithm>
+#include <limits>
+
+/**
+ * Kachanov-Rabotnov creep damage kernels shared by KRDamage and the material point tools
+ *
+ * Under a constant von Mises stress the damage evolution \f$ \dot{D} = k (1 - D)^{-\phi} \f$ with
+ * \f$ k = (\sigma_{vm} / a)^\zeta \f$ integrates in closed form to
+ * \f$ (1 - D)^{\phi + 1} = (1 - D_{old})^{\phi + 1} - (\phi + 1) k \Delta t \f$, which is exact
+ * for any time step and only requires \f$ \phi > -1 \f$.
+ */
+namespace KRDamageLaw
+{
+/// Damage rate \f$ \dot{D} = (\sigma_{vm} / a)^\zeta (1 - D)^{-\phi} \f$
+template <typename T>
+T
+rate(const T & effective_stress, const Real damage, const Real a, const Real phi, const Real zeta)
+{
+  return ViscoplasticFlowLaws::flowPow(T(effective_stress / a), zeta) *
+         std::pow(1.0 - damage, -phi);
+}
+
+/**
+ * Damage at the end of a time step of constant effective stress. Returns 1 if the material
+ * ruptures within the step.
+ */
+template <typename T>
+T
+damage(const T & effective_stress,
+       const Real damage_old,
+       const Real dt,
+       const Real a,
+       const Real phi,
+       const Real zeta)
+{
+  const Real exponent = phi + 1.0;
+  const T remaining = std::pow(1.0 - damage_old, exponent) -
+                      exponent * ViscoplasticFlowLaws::flowPow(T(effective_stress / a), zeta) * dt;
+  if (remaining <= 0.0)
+    return 1.0;
+
+  return 1.0 - std::pow(remaining, 1.0 / exponent);
+}
+
+/**
+ * Time for the damage to grow from damage to target_damage under a constant effective stress,
+ * the time to rupture for a target of 1
+ */
+inline Real
+timeToDamage(const Real effective_stress,
+             const Real damage,
+             const Real target_damage,
+             const Real a,
+             const Real phi,
+             const Real zeta)
+{
+  const Real exponent = phi + 1.0;
+  const Real k = ViscoplasticFlowLaws::flowPow(effective_stress / a, zeta);
+  if (k <= 0.0)
+    return std::numeric_limits<Real>::max();
+
+  const Real target_remaining = std::pow(1.0 - std::min(target_damage, 1.0), exponent);
+  return (std::pow(1.0 - damage, exponent) - target_remaining) / (exponent * k);
+}
+}
@@ -0,0 +1,123 @@
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <iosfwd>
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * Zero dimensional driver of the sloth viscoplastic models for calibration sweeps. Every parameter
+ * set of a grid is run as an independent ViscoplasticMaterialPoint under uniaxial stress through a
+ * prescribed axial strain (tension, relaxation) or axial stress (creep) history, without a mesh,
+ * assembly or a nonlinear solver, and the runs are spread over a pool of threads.
+ *
+ * The axial and lateral strains of each step are found by a Newton iteration on the controlled
+ * stress components, with a finite difference Jacobian of the material point update.
+ *
+ * Run from the sloth executable with
+ *
+ *   sloth-opt --material-point --model sinh|perzyna|peric --control strain|stress
+ *             --history history.csv --grid grid.csv [--output curves.csv] [--threads N]
+ *
+ * The history CSV has the columns time, value, temperature, where value is the axial strain or
+ * stress at that time, starting from an unloaded state at time 0. Every row of the grid CSV is one
+ * run. Its header names the parameters youngs_modulus, poissons_ratio, yield_stress, sat_stress,
+ * exp_rate and lin_rate, together with alpha and beta for the sinh model or n and eta for the
+ * power law models. A parameter that depends on temperature is given by several columns named
+ * name@temperature and interpolated linearly. The elastic constants are evaluated at the first
+ * temperature of the history.
+ */
+class MaterialPointDriver
+{
+public:
+  enum class Model
+  {
+    SINH,
+    PERZYNA,
+    PERIC
+  };
+
+  enum class Control
+  {
+    STRAIN,
+    STRESS
+  };
+
+  /// Controlled axial value and temperature at the end of a step
+  struct HistoryStep
+  {
+    Real time;
+    Real value;
+    Real temperature;
+  };
+
+  /// State at the end of a step
+  struct CurvePoint
+  {
+    Real time;
+    Real temperature;
+    Real strain;
+    Real stress;
+    Real effective_plastic_strain;
+    bool converged;
+  };
+
+  /// Temperature dependent parameters of a single run
+  class ParameterSet
+  {
+  public:
+    /// Add a sample of the parameter name at the given temperature
+    void add(const std::string & name, const Real temperature, const Real value);
+
+    /**
+     * Value of the parameter name at the given temperature, interpolated linearly between the
+     * samples and held constant outside of them
+     */
+    Real value(const std::string & name, const Real temperature) const;
+
+  private:
+    /// Samples of every parameter by temperature
+    std::map<std::string, std::map<Real, Real>> _samples;
+  };
+
+  MaterialPointDriver(const Model model,
+                      const Control control,
+                      const std::vector<HistoryStep> & history);
+
+  /// Run a single parameter set through the history
+  std::vector<CurvePoint> run(const ParameterSet & parameters) const;
+
+  /// Run every parameter set of the grid on up to num_threads threads
+  std::vector<std::vector<CurvePoint>> sweep(const std::vector<ParameterSet> & grid,
+                                             const unsigned int num_threads) const;
+
+  ///@{ CSV input and output, see the class description for the formats
+  static std::vector<HistoryStep> readHistory(std::istream & in);
+  static std::vector<ParameterSet> readGrid(std::istream & in);
+  static void writeCurves(std::ostream & out,
+                          const std::vector<std::vector<CurvePoint>> & curves);
+  ///@}
+
+  /// Whether the command line asks for the material point driver
+  static bool requested(const int argc, char * argv[]);
+
+  /// Command line entry point, returns the exit code
+  static int main(const int argc, char * argv[]);
+
+  ///@{ Newton iteration controls of the uniaxial stress state, the tolerance is relative to the
+  /// yield stress
+  Real stress_tolerance = 1.0e-8;
+  unsigned int max_iterations = 50;
+  ///@}
+
+protected:
+  /// Run a parameter set with the given flow law and Voce hardening
+  template <typename FlowLaw>
+  std::vector<CurvePoint> runModel(const ParameterSet & parameters) const;
+
+  const Model _model;
+  const Control _control;
+  const std::vector<HistoryStep> _history;
+};
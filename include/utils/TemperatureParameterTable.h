@@ -0,0 +1,101 @@
+#pragma once
+
+#include "MooseTypes.h"
+
+#include <algorithm>
+#include <vector>
+
+/**
+ * Piecewise linear table of several material parameters sampled at the same temperatures. The
+ * value and slope of every parameter on an interval are packed next to each other, so all
+ * parameters at a temperature come out of one interval search and a single contiguous read rather
+ * than one interpolating material per parameter.
+ *
+ * The parameters are held constant at their end values outside of the tabulated range, like
+ * PiecewiseLinear with extrapolation disabled.
+ */
+class TemperatureParameterTable
+{
+public:
+  /**
+   * @param temperatures strictly increasing sample temperatures
+   * @param columns one vector of samples per parameter, each the size of temperatures
+   */
+  TemperatureParameterTable(const std::vector<Real> & temperatures,
+                            const std::vector<std::vector<Real>> & columns);
+
+  /// Number of tabulated parameters
+  std::size_t numParameters() const { return _num_parameters; }
+
+  /// Interpolate every parameter at the given temperature into values[0, numParameters())
+  void evaluate(const Real temperature, Real * values) const;
+
+  /**
+   * Interpolate every parameter and its temperature derivative, the slope of the interval, which is
+   * zero outside of the tabulated range
+   */
+  void evaluate(const Real temperature, Real * values, Real * slopes) const;
+
+private:
+  const std::vector<Real> _temperatures;
+  const std::size_t _num_parameters;
+
+  /// Per interval: the value of every parameter at the lower end, followed by its slope
+  std::vector<Real> _packed;
+};
+
+inline void
+TemperatureParameterTable::evaluate(const Real temperature, Real * values) const
+{
+  const std::size_t n = _num_parameters;
+  const std::size_t num_intervals = _temperatures.size() - 1;
+
+  // constant extension below and above the table, a single point table is constant everywhere
+  if (num_intervals == 0 || temperature <= _temperatures.front())
+  {
+    std::copy_n(_packed.begin(), n, values);
+    return;
+  }
+  if (temperature >= _temperatures.back())
+  {
+    const Real * row = _packed.data() + (num_intervals - 1) * 2 * n;
+    const Real dt = _temperatures.back() - _temperatures[num_intervals - 1];
+    for (std::size_t j = 0; j < n; ++j)
+      values[j] = row[j] + row[n + j] * dt;
+    return;
+  }
+
+  const std::size_t i =
+      std::upper_bound(_temperatures.begin(), _temperatures.end(), temperature) -
+      _temperatures.begin() - 1;
+  const Real * row = _packed.data() + i * 2 * n;
+  const Real dt = temperature - _temperatures[i];
+  for (std::size_t j = 0; j < n; ++j)
+    values[j] = row[j] + row[n + j] * dt;
+}
+
+inline void
+TemperatureParameterTable::evaluate(const Real temperature, Real * values, Real * slopes) const
+{
+  const std::size_t n = _num_parameters;
+
+  // the constant extension has no slope
+  if (_temperatures.size() < 2 || temperature <= _temperatures.front() ||
+      temperature >= _temperatures.back())
+  {
+    evaluate(temperature, values);
+    std::fill_n(slopes, n, 0.0);
+    return;
+  }
+
+  const std::size_t i =
+      std::upper_bound(_temperatures.begin(), _temperatures.end(), temperature) -
+      _temperatures.begin() - 1;
+  const Real * row = _packed.data() + i * 2 * n;
+  const Real dt = temperature - _temperatures[i];
+  for (std::size_t j = 0; j < n; ++j)
+  {
+    values[j] = row[j] + row[n + j] * dt;
+    slopes[j] = row[n + j];
+  }
+}
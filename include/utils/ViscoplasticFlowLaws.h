@@ -0,0 +1,489 @@
+#pragma once
+
+#include "MooseTypes.h"
+#include "MathUtils.h"
+
+#include <cmath>
+
+/**
+ * Fused kernels for the scalar viscoplastic flow laws used by the sloth radial return stress
+ * updates. Each kernel returns the flow rate together with its partial derivatives, computed from a
+ * single transcendental evaluation, so that the return mapping residual and its derivative come
+ * out of the same evaluation at the same iterate.
+ */
+namespace ViscoplasticFlowLaws
+{
+/// Effective plastic strain rate and its partial derivatives
+template <typename T>
+struct FlowRate
+{
+  /// effective plastic strain rate
+  T rate;
+  /// derivative of the rate with respect to the effective stress
+  T drate_dstress;
+  /// derivative of the rate with respect to the flow stress (yield stress plus hardening)
+  T drate_dflow_stress;
+};
+
+/**
+ * Residual of an inverted flow law, \f$ r = g(\sigma_e, \sigma_f) - g(\dot{p}) \f$, and its partial
+ * derivatives. Unlike the rate, this residual stays bounded for large overstresses.
+ */
+template <typename T>
+struct BoundedResidual
+{
+  T residual;
+  T dresidual_dstress;
+  T dresidual_dflow_stress;
+  T dresidual_drate;
+};
+
+/// Largest integer exponent evaluated by repeated multiplication rather than std::pow
+const int max_integer_exponent = 16;
+
+/**
+ * \f$ x^n \f$ for the power law flow rules. Integer exponents, which are the common choice for
+ * calibrated power laws, are evaluated with MathUtils::pow and avoid the exp and log inside
+ * std::pow.
+ */
+template <typename T>
+T
+flowPow(const T & x, const Real n)
+{
+  const int integer_n = static_cast<int>(n);
+  if (integer_n == n && integer_n >= 0 && integer_n <= max_integer_exponent)
+    return MathUtils::pow(x, integer_n);
+
+  return std::pow(x, n);
+}
+
+/// \f$ \dot{p} = \alpha \sinh \beta (\sigma_e - \sigma_f) \f$
+template <typename T>
+FlowRate<T>
+sinh(const T & effective_stress, const T & flow_stress, const Real alpha, const Real beta)
+{
+  const T sinh_flow = std::sinh(beta * (effective_stress - flow_stress));
+  // cosh from sinh avoids a second transcendental evaluation
+  const T cosh_flow = std::sqrt(1.0 + sinh_flow * sinh_flow);
+
+  return {alpha * sinh_flow, alpha * beta * cosh_flow, -alpha * beta * cosh_flow};
+}
+
+/// \f$ \dot{p} = \eta (\sigma_e / \sigma_f - 1)^n \f$
+template <typename T>
+FlowRate<T>
+perzyna(const T & effective_stress, const T & flow_stress, const Real n, const Real eta)
+{
+  const T xflow = effective_stress / flow_stress - 1.0;
+  const T xflow_pow = flowPow(xflow, n - 1.0);
+  const T dxflow = eta * n * xflow_pow / flow_stress;
+
+  return {eta * xflow_pow * xflow, dxflow, -dxflow * effective_stress / flow_stress};
+}
+
+/// \f$ \dot{p} = \eta ((\sigma_e / \sigma_f)^n - 1) \f$
+template <typename T>
+FlowRate<T>
+peric(const T & effective_stress, const T & flow_stress, const Real n, const Real eta)
+{
+  const T xflow = effective_stress / flow_stress;
+  const T xflow_pow = flowPow(xflow, n - 1.0);
+  const T dxflow = eta * n * xflow_pow / flow_stress;
+
+  return {eta * (xflow_pow * xflow - 1.0), dxflow, -dxflow * xflow};
+}
+
+/// \f$ \dot{p} = A \sigma_e^n \f$, power law creep without a threshold
+template <typename T>
+FlowRate<T>
+powerLawCreep(const T & effective_stress, const Real coefficient, const Real n)
+{
+  const T stress_pow = flowPow(effective_stress, n - 1.0);
+
+  return {coefficient * stress_pow * effective_stress, coefficient * n * stress_pow, 0.0};
+}
+
+/**
+ * Change of the sinh rate and its partial derivatives for a change dalpha and dbeta of the
+ * coefficients and dflow_stress of the flow stress, at a fixed effective stress
+ */
+template <typename T>
+FlowRate<T>
+sinhDerivative(const T & effective_stress,
+               const T & flow_stress,
+               const Real alpha,
+               const Real beta,
+               const Real dalpha,
+               const Real dbeta,
+               const T & dflow_stress)
+{
+  const T overstress = effective_stress - flow_stress;
+  const T sinh_flow = std::sinh(beta * overstress);
+  const T cosh_flow = std::sqrt(1.0 + sinh_flow * sinh_flow);
+  const T dargument = dbeta * overstress - beta * dflow_stress;
+  const T ddrate_dstress =
+      (dalpha * beta + alpha * dbeta) * cosh_flow + alpha * beta * sinh_flow * dargument;
+
+  return {dalpha * sinh_flow + alpha * cosh_flow * dargument, ddrate_dstress, -ddrate_dstress};
+}
+
+/**
+ * Change of the Perzyna rate and its partial derivatives for a change dn and deta of the
+ * coefficients and dflow_stress of the flow stress, at a fixed effective stress above the flow
+ * stress
+ */
+template <typename T>
+FlowRate<T>
+perzynaDerivative(const T & effective_stress,
+                  const T & flow_stress,
+                  const Real n,
+                  const Real eta,
+                  const Real dn,
+                  const Real deta,
+                  const T & dflow_stress)
+{
+  const T stress_ratio = effective_stress / flow_stress;
+  const T xflow = stress_ratio - 1.0;
+  const T xflow_pow = flowPow(xflow, n - 1.0);
+  const T dxflow = -stress_ratio * dflow_stress / flow_stress;
+  // the logarithm of the exponent derivative is only taken if the exponent changes
+  const T log_xflow = dn != 0.0 ? T(std::log(xflow)) : T(0.0);
+  const T dxflow_pow = xflow_pow * (dn * log_xflow + (n - 1.0) * dxflow / xflow);
+
+  const T drate_dstress = eta * n * xflow_pow / flow_stress;
+  const T ddrate_dstress =
+      ((deta * n + eta * dn) * xflow_pow + eta * n * dxflow_pow - drate_dstress * dflow_stress) /
+      flow_stress;
+
+  return {deta * xflow_pow * xflow + eta * (dxflow_pow * xflow + xflow_pow * dxflow),
+          ddrate_dstress,
+          (drate_dstress * dflow_stress / flow_stress - ddrate_dstress) * stress_ratio};
+}
+
+/**
+ * Change of the Peric rate and its partial derivatives for a change dn and deta of the
+ * coefficients and dflow_stress of the flow stress, at a fixed effective stress above the flow
+ * stress
+ */
+template <typename T>
+FlowRate<T>
+pericDerivative(const T & effective_stress,
+                const T & flow_stress,
+                const Real n,
+                const Real eta,
+                const Real dn,
+                const Real deta,
+                const T & dflow_stress)
+{
+  const T xflow = effective_stress / flow_stress;
+  const T xflow_pow = flowPow(xflow, n - 1.0);
+  const T dxflow = -xflow * dflow_stress / flow_stress;
+  const T log_xflow = dn != 0.0 ? T(std::log(xflow)) : T(0.0);
+  const T dxflow_pow = xflow_pow * (dn * log_xflow + (n - 1.0) * dxflow / xflow);
+
+  const T drate_dstress = eta * n * xflow_pow / flow_stress;
+  const T ddrate_dstress =
+      ((deta * n + eta * dn) * xflow_pow + eta * n * dxflow_pow - drate_dstress * dflow_stress) /
+      flow_stress;
+
+  return {deta * (xflow_pow * xflow - 1.0) + eta * (dxflow_pow * xflow + xflow_pow * dxflow),
+          ddrate_dstress,
+          -ddrate_dstress * xflow - drate_dstress * dxflow};
+}
+
+/**
+ * Change of the power law creep rate and its stress derivative for a change dcoefficient and dn of
+ * the coefficients, at a fixed positive effective stress
+ */
+template <typename T>
+FlowRate<T>
+powerLawCreepDerivative(const T & effective_stress,
+                        const Real coefficient,
+                        const Real n,
+                        const Real dcoefficient,
+                        const Real dn)
+{
+  const T stress_pow = flowPow(effective_stress, n - 1.0);
+  const T log_stress = dn != 0.0 ? T(std::log(effective_stress)) : T(0.0);
+  const T dstress_pow = stress_pow * dn * log_stress;
+
+  return {(dcoefficient * stress_pow + coefficient * dstress_pow) * effective_stress,
+          (dcoefficient * n + coefficient * dn) * stress_pow + coefficient * n * dstress_pow,
+          0.0};
+}
+
+/**
+ * Flow law policies for ViscoplasticityStressUpdateBaseTempl. Each policy bundles the constant
+ * coefficients of its law, which the stress update gathers once per quadrature point, with a
+ * static, inlinable evaluation of the flow rate. hasThreshold() tells whether the law only flows
+ * above the flow stress, so that points below it are elastic, and equal() compares coefficients.
+ * coefficientDerivative() gives the change of the rate and its partial derivatives along a change
+ * of the coefficients and of the flow stress, for coefficients that depend on a coupled quantity.
+ */
+///@{
+struct SinhFlow
+{
+  struct Coefficients
+  {
+    Real alpha;
+    Real beta;
+  };
+
+  static constexpr bool has_bounded_residual = true;
+
+  static bool hasThreshold(const Coefficients &) { return true; }
+
+  static bool equal(const Coefficients & a, const Coefficients & b)
+  {
+    return a.alpha == b.alpha && a.beta == b.beta;
+  }
+
+  template <typename T>
+  static FlowRate<T>
+  evaluate(const T & effective_stress, const T & flow_stress, const Coefficients & c)
+  {
+    return sinh(effective_stress, flow_stress, c.alpha, c.beta);
+  }
+
+  template <typename T>
+  static FlowRate<T> coefficientDerivative(const T & effective_stress,
+                                           const T & flow_stress,
+                                           const Coefficients & c,
+                                           const Coefficients & dc,
+                                           const T & dflow_stress)
+  {
+    return sinhDerivative(
+        effective_stress, flow_stress, c.alpha, c.beta, dc.alpha, dc.beta, dflow_stress);
+  }
+
+  /// \f$ r = \beta (\sigma_e - \sigma_f) - \sinh^{-1}(\dot{p} / \alpha) \f$, free of overflow
+  template <typename T>
+  static BoundedResidual<T> evaluateBounded(const T & effective_stress,
+                                            const T & flow_stress,
+                                            const T & rate,
+                                            const Coefficients & c)
+  {
+    const T scaled_rate = rate / c.alpha;
+    return {c.beta * (effective_stress - flow_stress) - std::asinh(scaled_rate),
+            c.beta,
+            -c.beta,
+            -1.0 / (c.alpha * std::sqrt(1.0 + scaled_rate * scaled_rate))};
+  }
+
+  /// Change of the bounded residual along dc and dflow_stress, at a fixed stress and rate
+  template <typename T>
+  static T boundedCoefficientDerivative(const T & effective_stress,
+                                        const T & flow_stress,
+                                        const T & rate,
+                                        const Coefficients & c,
+                                        const Coefficients & dc,
+                                        const T & dflow_stress)
+  {
+    const T scaled_rate = rate / c.alpha;
+    return dc.beta * (effective_stress - flow_stress) - c.beta * dflow_stress +
+           scaled_rate * dc.alpha / (c.alpha * std::sqrt(1.0 + scaled_rate * scaled_rate));
+  }
+};
+
+struct PerzynaFlow
+{
+  struct Coefficients
+  {
+    Real n;
+    Real eta;
+  };
+
+  static constexpr bool has_bounded_residual = false;
+
+  static bool hasThreshold(const Coefficients &) { return true; }
+
+  static bool equal(const Coefficients & a, const Coefficients & b)
+  {
+    return a.n == b.n && a.eta == b.eta;
+  }
+
+  template <typename T>
+  static FlowRate<T>
+  evaluate(const T & effective_stress, const T & flow_stress, const Coefficients & c)
+  {
+    return perzyna(effective_stress, flow_stress, c.n, c.eta);
+  }
+
+  template <typename T>
+  static FlowRate<T> coefficientDerivative(const T & effective_stress,
+                                           const T & flow_stress,
+                                           const Coefficients & c,
+                                           const Coefficients & dc,
+                                           const T & dflow_stress)
+  {
+    return perzynaDerivative(effective_stress, flow_stress, c.n, c.eta, dc.n, dc.eta, dflow_stress);
+  }
+};
+
+struct PericFlow
+{
+  struct Coefficients
+  {
+    Real n;
+    Real eta;
+  };
+
+  static constexpr bool has_bounded_residual = false;
+
+  static bool hasThreshold(const Coefficients &) { return true; }
+
+  static bool equal(const Coefficients & a, const Coefficients & b)
+  {
+    return a.n == b.n && a.eta == b.eta;
+  }
+
+  template <typename T>
+  static FlowRate<T>
+  evaluate(const T & effective_stress, const T & flow_stress, const Coefficients & c)
+  {
+    return peric(effective_stress, flow_stress, c.n, c.eta);
+  }
+
+  template <typename T>
+  static FlowRate<T> coefficientDerivative(const T & effective_stress,
+                                           const T & flow_stress,
+                                           const Coefficients & c,
+                                           const Coefficients & dc,
+                                           const T & dflow_stress)
+  {
+    return pericDerivative(effective_stress, flow_stress, c.n, c.eta, dc.n, dc.eta, dflow_stress);
+  }
+};
+
+/**
+ * Sum of the sinh, Perzyna and Peric overstress laws and a power law creep term, sharing the flow
+ * stress of a single hardening law. A mechanism with a zero rate coefficient is inactive. The
+ * overstress laws are clamped to zero below the flow stress, while the creep term flows at any
+ * stress, in which case the law has no threshold.
+ */
+struct CompositeFlow
+{
+  /// Number of mechanisms, in the order of rates()
+  static constexpr unsigned int num_mechanisms = 4;
+
+  struct Coefficients
+  {
+    SinhFlow::Coefficients sinh;
+    PerzynaFlow::Coefficients perzyna;
+    PericFlow::Coefficients peric;
+    Real creep_coefficient;
+    Real creep_exponent;
+  };
+
+  static constexpr bool has_bounded_residual = false;
+
+  static bool hasThreshold(const Coefficients & c) { return c.creep_coefficient == 0.0; }
+
+  static bool equal(const Coefficients & a, const Coefficients & b)
+  {
+    return SinhFlow::equal(a.sinh, b.sinh) && PerzynaFlow::equal(a.perzyna, b.perzyna) &&
+           PericFlow::equal(a.peric, b.peric) && a.creep_coefficient == b.creep_coefficient &&
+           a.creep_exponent == b.creep_exponent;
+  }
+
+  template <typename T>
+  static FlowRate<T>
+  evaluate(const T & effective_stress, const T & flow_stress, const Coefficients & c)
+  {
+    FlowRate<T> total = {0.0, 0.0, 0.0};
+    FlowRate<T> mechanisms[num_mechanisms];
+    rates(effective_stress, flow_stress, c, mechanisms);
+    for (const auto & mechanism : mechanisms)
+    {
+      total.rate += mechanism.rate;
+      total.drate_dstress += mechanism.drate_dstress;
+      total.drate_dflow_stress += mechanism.drate_dflow_stress;
+    }
+    return total;
+  }
+
+  /// Sum of the changes of the mechanisms that are active at the given stresses
+  template <typename T>
+  static FlowRate<T> coefficientDerivative(const T & effective_stress,
+                                           const T & flow_stress,
+                                           const Coefficients & c,
+                                           const Coefficients & dc,
+                                           const T & dflow_stress)
+  {
+    FlowRate<T> total = {0.0, 0.0, 0.0};
+    const auto add = [&total](const FlowRate<T> & mechanism)
+    {
+      total.rate += mechanism.rate;
+      total.drate_dstress += mechanism.drate_dstress;
+      total.drate_dflow_stress += mechanism.drate_dflow_stress;
+    };
+
+    if (effective_stress > flow_stress)
+    {
+      if (c.sinh.alpha != 0.0)
+        add(SinhFlow::coefficientDerivative(
+            effective_stress, flow_stress, c.sinh, dc.sinh, dflow_stress));
+      if (c.perzyna.eta != 0.0)
+        add(PerzynaFlow::coefficientDerivative(
+            effective_stress, flow_stress, c.perzyna, dc.perzyna, dflow_stress));
+      if (c.peric.eta != 0.0)
+        add(PericFlow::coefficientDerivative(
+            effective_stress, flow_stress, c.peric, dc.peric, dflow_stress));
+    }
+
+    if (c.creep_coefficient != 0.0 && effective_stress > 0.0)
+      add(powerLawCreepDerivative(effective_stress,
+                                  c.creep_coefficient,
+                                  c.creep_exponent,
+                                  dc.creep_coefficient,
+                                  dc.creep_exponent));
+    return total;
+  }
+
+  /// Rates of the individual mechanisms: sinh, Perzyna, Peric and creep
+  template <typename T>
+  static void rates(const T & effective_stress,
+                    const T & flow_stress,
+                    const Coefficients & c,
+                    FlowRate<T> (&mechanisms)[num_mechanisms])
+  {
+    for (auto & mechanism : mechanisms)
+      mechanism = {0.0, 0.0, 0.0};
+
+    if (effective_stress > flow_stress)
+    {
+      if (c.sinh.alpha != 0.0)
+        mechanisms[0] = SinhFlow::evaluate(effective_stress, flow_stress, c.sinh);
+      if (c.perzyna.eta != 0.0)
+        mechanisms[1] = PerzynaFlow::evaluate(effective_stress, flow_stress, c.perzyna);
+      if (c.peric.eta != 0.0)
+        mechanisms[2] = PericFlow::evaluate(effective_stress, flow_stress, c.peric);
+    }
+
+    if (c.creep_coefficient != 0.0 && effective_stress > 0.0)
+      mechanisms[3] = powerLawCreep(effective_stress, c.creep_coefficient, c.creep_exponent);
+  }
+};
+///@}
+
+/**
+ * Radial return residual \f$ r = \dot{p} \Delta t - \Delta p \f$ and its derivative with respect
+ * to the scalar increment, with the effective stress \f$ \sigma_e = \sigma^{tr}_e - 3 G \Delta p
+ * \f$ and the hardening slope both taken at the current iterate
+ */
+template <typename T, typename G>
+void
+radialReturnResidual(const FlowRate<T> & flow,
+                     const T & hardening_slope,
+                     const G & three_shear_modulus,
+                     const Real dt,
+                     const T & scalar,
+                     T & residual,
+                     T & derivative)
+{
+  residual = flow.rate * dt - scalar;
+  derivative =
+      (-three_shear_modulus * flow.drate_dstress + flow.drate_dflow_stress * hardening_slope) * dt -
+      1.0;
+}
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "MooseTypes.h"
+#include "Function.h"
+#include "HardeningCurveTable.h"
+#include "metaphysicl/raw_type.h"
+
+#include <cmath>
+#include <type_traits>
+
+/**
+ * Isotropic hardening policies for ViscoplasticityStressUpdateBaseTempl. Each policy bundles the
+ * coefficients of its hardening law, gathered once per quadrature point by the stress update, with
+ * a static, inlinable evaluation of the hardening value and slope at an effective plastic strain,
+ * a comparison of coefficients, and the change of the value and slope along a change of the
+ * coefficients.
+ */
+namespace ViscoplasticHardeningLaws
+{
+/// Voce hardening \f$ r = Q (1 - e^{-b p}) + H p \f$, value and slope from a single exp
+struct VoceHardening
+{
+  struct Coefficients
+  {
+    Real sat_stress;
+    Real exp_rate;
+    Real lin_rate;
+  };
+
+  template <typename T>
+  static void evaluate(const T & strain, const Coefficients & c, T & value, T & slope)
+  {
+    const T saturation = c.sat_stress * std::exp(-c.exp_rate * strain);
+    value = c.sat_stress - saturation + c.lin_rate * strain;
+    slope = c.exp_rate * saturation + c.lin_rate;
+  }
+
+  /// Change of the value and the slope for a change dc of the coefficients
+  template <typename T>
+  static void coefficientDerivative(
+      const T & strain, const Coefficients & c, const Coefficients & dc, T & dvalue, T & dslope)
+  {
+    const T exponential = std::exp(-c.exp_rate * strain);
+    const T dsaturation = (dc.sat_stress - c.sat_stress * dc.exp_rate * strain) * exponential;
+    dvalue = dc.sat_stress - dsaturation + dc.lin_rate * strain;
+    dslope = dc.exp_rate * c.sat_stress * exponential + c.exp_rate * dsaturation + dc.lin_rate;
+  }
+
+  static bool equal(const Coefficients & a, const Coefficients & b)
+  {
+    return a.sat_stress == b.sat_stress && a.exp_rate == b.exp_rate && a.lin_rate == b.lin_rate;
+  }
+};
+
+/**
+ * Hardening stress given as a Function of effective plastic strain, evaluated through a shared
+ * HardeningCurveTable when one has been built
+ */
+struct FunctionHardening
+{
+  struct Coefficients
+  {
+    const Function * function;
+    /// tabulated function, nullptr to evaluate the function directly
+    const HardeningCurveTable * table;
+    Point point;
+  };
+
+  template <typename T>
+  static void evaluate(const T & strain, const Coefficients & c, T & value, T & slope)
+  {
+    if (c.table)
+    {
+      c.table->evaluate(strain, value, slope);
+      return;
+    }
+
+    const Real raw_strain = MetaPhysicL::raw_value(strain);
+    const Real raw_value = c.function->value(raw_strain, c.point);
+    slope = c.function->timeDerivative(raw_strain, c.point);
+
+    if constexpr (std::is_same<T, Real>::value)
+      value = raw_value;
+    else
+      // carry the derivatives of the strain through the slope of the function
+      value = raw_value + slope * (strain - raw_strain);
+  }
+
+  /// The function has no coefficients that could change
+  template <typename T>
+  static void coefficientDerivative(
+      const T &, const Coefficients &, const Coefficients &, T & dvalue, T & dslope)
+  {
+    dvalue = 0.0;
+    dslope = 0.0;
+  }
+
+  static bool equal(const Coefficients & a, const Coefficients & b)
+  {
+    return a.function == b.function && a.table == b.table && a.point == b.point;
+  }
+};
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "ViscoplasticReturnMapping.h"
+#include "RankTwoTensor.h"
+
+/**
+ * Isotropic elastic, viscoplastic material point that integrates the same flow law and hardening
+ * law policies as ViscoplasticityStressUpdateBaseTempl under small strain increments, without a
+ * mesh or a MOOSE problem. The committed state is only advanced by commit(), so an update can be
+ * repeated, for example by a driver iterating on the strain increment.
+ */
+template <typename T, typename FlowLaw, typename Hardening>
+class ViscoplasticMaterialPoint
+{
+public:
+  ViscoplasticMaterialPoint(const Real youngs_modulus, const Real poissons_ratio)
+    : _shear_modulus(youngs_modulus / (2.0 * (1.0 + poissons_ratio))),
+      _lambda(youngs_modulus * poissons_ratio /
+              ((1.0 + poissons_ratio) * (1.0 - 2.0 * poissons_ratio)))
+  {
+  }
+
+  /**
+   * Compute the state at the end of a step from the committed state
+   * @return true if the return mapping converged
+   */
+  bool update(const RankTwoTensorTempl<T> & strain_increment, const Real dt);
+
+  /// Accept the last update as the state at the start of the next step
+  void commit();
+
+  /// Number of return mapping iterations of the last update
+  unsigned int iterations() const { return return_mapping.iterations(); }
+
+  /// Law coefficients and convergence controls, may be changed between steps
+  ViscoplasticReturnMapping<T, FlowLaw, Hardening> return_mapping;
+
+  ///@{ State at the end of the last update
+  RankTwoTensorTempl<T> stress;
+  RankTwoTensorTempl<T> plastic_strain;
+  T effective_plastic_strain = 0.0;
+  T hardening = 0.0;
+  ///@}
+
+protected:
+  const Real _shear_modulus;
+  const Real _lambda;
+
+  ///@{ Committed state
+  RankTwoTensorTempl<T> _stress_old;
+  RankTwoTensorTempl<T> _plastic_strain_old;
+  T _effective_plastic_strain_old = 0.0;
+  T _hardening_old = 0.0;
+  ///@}
+};
+
+template <typename T, typename FlowLaw, typename Hardening>
+bool
+ViscoplasticMaterialPoint<T, FlowLaw, Hardening>::update(
+    const RankTwoTensorTempl<T> & strain_increment, const Real dt)
+{
+  const RankTwoTensorTempl<T> trial_stress =
+      _stress_old + RankTwoTensorTempl<T>::Identity() * (_lambda * strain_increment.trace()) +
+      strain_increment * (2.0 * _shear_modulus);
+  const RankTwoTensorTempl<T> deviatoric_trial_stress = trial_stress.deviatoric();
+  const T effective_trial_stress =
+      std::sqrt(1.5 * deviatoric_trial_stress.doubleContraction(deviatoric_trial_stress));
+
+  T scalar;
+  const bool converged = return_mapping.solve(effective_trial_stress,
+                                              T(3.0 * _shear_modulus),
+                                              _effective_plastic_strain_old,
+                                              _hardening_old,
+                                              dt,
+                                              scalar,
+                                              hardening);
+
+  // radial return along the deviatoric trial stress
+  RankTwoTensorTempl<T> plastic_strain_increment;
+  if (MetaPhysicL::raw_value(scalar) > 0.0)
+    plastic_strain_increment = deviatoric_trial_stress * (1.5 * scalar / effective_trial_stress);
+
+  stress = trial_stress - plastic_strain_increment * (2.0 * _shear_modulus);
+  plastic_strain = _plastic_strain_old + plastic_strain_increment;
+  effective_plastic_strain = _effective_plastic_strain_old + scalar;
+
+  return converged;
+}
+
+template <typename T, typename FlowLaw, typename Hardening>
+void
+ViscoplasticMaterialPoint<T, FlowLaw, Hardening>::commit()
+{
+  _stress_old = stress;
+  _plastic_strain_old = plastic_strain;
+  _effective_plastic_strain_old = effective_plastic_strain;
+  _hardening_old = hardening;
+}
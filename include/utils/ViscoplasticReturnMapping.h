@@ -0,0 +1,727 @@
+#pragma once
+
+#include "MooseTypes.h"
+#include "ViscoplasticFlowLaws.h"
+#include "metaphysicl/raw_type.h"
+
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+/**
+ * Scalar radial return solve of a flow law and hardening law policy pair, see
+ * ViscoplasticityStressUpdateBaseTempl, outside of the MOOSE return mapping. The residual and its
+ * derivative are evaluated with the same kernels as the stress updates, and the iteration uses the
+ * tolerances and the [0, trial stress / 3G] bounds of SingleVariableReturnMappingSolution.
+ *
+ * Newton steps are safeguarded by the bracket of the root that the sign of the residual provides,
+ * steps leaving the bracket or producing non-finite values fall back to bisection. Flow laws with a
+ * bounded residual can optionally be solved in that form, which avoids the overflow of the rate at
+ * large overstresses, and solveSubstepped() splits the time step at the point when a solve fails.
+ * For low rates explicitStep() replaces the iteration by a single linearized implicit step, which
+ * is accepted if its local error estimate is small enough.
+ *
+ * T is Real or ADReal. With ADReal the iterates carry the derivatives of the trial stress.
+ * Coefficients that depend on other quantities, such as a coupled temperature, are differentiated
+ * along coefficient_derivatives through the implicit function theorem on the converged residual.
+ */
+template <typename T, typename FlowLaw, typename Hardening>
+class ViscoplasticReturnMapping
+{
+public:
+  /**
+   * Solve for the effective plastic strain increment over a single step
+   * @param effective_trial_stress von Mises stress of the elastic trial state
+   * @param three_shear_modulus three times the elastic shear modulus
+   * @param strain_old effective plastic strain at the start of the step
+   * @param hardening_old hardening value at the start of the step, used for the yield check
+   * @param dt time step
+   * @param scalar effective plastic strain increment, zero for an elastic step
+   * @param hardening hardening value at the converged increment
+   * @return true if the solve converged within max_its iterations
+   */
+  bool solve(const T & effective_trial_stress,
+             const T & three_shear_modulus,
+             const T & strain_old,
+             const T & hardening_old,
+             const Real dt,
+             T & scalar,
+             T & hardening);
+
+  /**
+   * Solve for the effective plastic strain increment, splitting the step into up to max_substeps
+   * substeps if the single step solve fails. Within the step the stress is ramped linearly from the
+   * old stress to the trial stress, so a single substep is identical to solve(). The von Mises
+   * stress along that path follows from the old and trial von Mises stresses and the projection of
+   * the old deviatoric stress onto the trial direction, \f$ \frac{3}{2} s_{old} : s^{tr} /
+   * \sigma^{tr}_e \f$, which equals effective_stress_old if both stresses are coaxial.
+   *
+   * The derivatives of the summed increment with respect to the effective trial stress, the
+   * projected old stress, three times the shear modulus and along coefficient_derivatives are
+   * chained through the substeps and available from the increment sensitivity accessors.
+   */
+  bool solveSubstepped(const T & effective_stress_old,
+                       const T & projected_stress_old,
+                       const T & effective_trial_stress,
+                       const T & three_shear_modulus,
+                       const T & strain_old,
+                       const T & hardening_old,
+                       const Real dt,
+                       T & scalar,
+                       T & hardening);
+
+  /**
+   * Single linearized implicit (Rosenbrock) step from a zero increment, at the cost of one flow law
+   * evaluation. The difference to the forward Euler increment of the same evaluation estimates the
+   * local error of the step, which is first order in the time step.
+   * @param error_tolerance largest accepted error estimate of the increment
+   * @param scalar effective plastic strain increment, zero for an elastic step
+   * @param hardening hardening value at the increment
+   * @param error error estimate of the increment
+   * @return true if the step is elastic or its error estimate is within error_tolerance, false if
+   * the increment has to be solved by the implicit iteration
+   */
+  bool explicitStep(const T & effective_trial_stress,
+                    const T & three_shear_modulus,
+                    const T & strain_old,
+                    const T & hardening_old,
+                    const Real dt,
+                    const Real error_tolerance,
+                    T & scalar,
+                    T & hardening,
+                    Real & error) const;
+
+  /**
+   * Derivative of a converged increment with respect to the effective trial stress, from the
+   * derivatives of the residual at the solution. This is the scalar part of the algorithmic
+   * consistent tangent, zero for an elastic step or where it is not finite.
+   */
+  T incrementStressDerivative(const T & effective_trial_stress,
+                              const T & three_shear_modulus,
+                              const T & strain_old,
+                              const Real dt,
+                              const T & scalar) const;
+
+  /// Change of the law coefficients with a quantity they depend on
+  struct CoefficientDerivatives
+  {
+    Real yield_stress;
+    typename FlowLaw::Coefficients flow;
+    typename Hardening::Coefficients hardening_law;
+  };
+
+  /**
+   * Derivative of an accepted plastic explicitStep increment along the coefficient derivatives,
+   * from the derivatives of the forward Euler increment and of the residual derivative it is
+   * divided by
+   */
+  T explicitStepCoefficientDerivative(const T & effective_trial_stress,
+                                      const T & three_shear_modulus,
+                                      const T & strain_old,
+                                      const Real dt,
+                                      const CoefficientDerivatives & dcoefficients) const;
+
+  /// Number of iterations taken by the last solve, summed over all attempted substeps
+  unsigned int iterations() const { return _iterations; }
+
+  /// Number of substeps of the last solveSubstepped
+  unsigned int substeps() const { return _substeps; }
+
+  ///@{ Derivatives of the increment of the last successful solveSubstepped
+  Real incrementStressSensitivity() const { return _dscalar_dtrial_stress; }
+  Real incrementProjectionSensitivity() const { return _dscalar_dprojected_stress; }
+  Real incrementModulusSensitivity() const { return _dscalar_dthree_shear_modulus; }
+  Real incrementCoefficientSensitivity(const unsigned int i) const
+  {
+    return _dscalar_dcoefficients[i];
+  }
+  ///@}
+
+  ///@{ Law coefficients
+  Real yield_stress = 0.0;
+  typename FlowLaw::Coefficients flow = {};
+  typename Hardening::Coefficients hardening_law = {};
+  ///@}
+
+  /**
+   * Derivatives of the coefficients with respect to the quantities they depend on, along which
+   * solveSubstepped chains the derivatives of the increment through the substeps
+   */
+  std::vector<CoefficientDerivatives> coefficient_derivatives;
+
+  ///@{ Convergence controls, defaults match SingleVariableReturnMappingSolution
+  Real relative_tolerance = 1.0e-8;
+  Real absolute_tolerance = 1.0e-11;
+  unsigned int max_its = 1000;
+  ///@}
+
+  /**
+   * Plastic strain rate the first iterate is extrapolated from, typically the rate of the previous
+   * step. The solve starts from initial_rate * dt if that lies within the bracket of the root and
+   * from zero otherwise.
+   */
+  Real initial_rate = 0.0;
+
+  /// Solve the bounded residual of the flow law, if it provides one
+  bool bounded_residual = false;
+
+  /// Largest number of substeps of solveSubstepped, rounded down to a power of two
+  unsigned int max_substeps = 1;
+
+protected:
+  /// The batch iterates its points with the residual kernel and the checks of their return mappings
+  template <typename, typename>
+  friend class ViscoplasticReturnMappingBatch;
+
+  /**
+   * Residual and its derivative at scalar, also updates the hardening value and, if given, the
+   * partial derivatives of the residual with respect to the effective trial stress and the strain
+   * at the start of the step
+   */
+  void computeResidual(const T & effective_trial_stress,
+                       const T & three_shear_modulus,
+                       const T & strain_old,
+                       const Real dt,
+                       const T & scalar,
+                       T & hardening,
+                       T & residual,
+                       T & derivative,
+                       T * dresidual_dtrial_stress = nullptr,
+                       T * dresidual_dstrain_old = nullptr) const;
+
+  /// Change of the residual at scalar along the coefficient derivatives
+  T residualCoefficientDerivative(const T & effective_trial_stress,
+                                  const T & three_shear_modulus,
+                                  const T & strain_old,
+                                  const Real dt,
+                                  const T & scalar,
+                                  const CoefficientDerivatives & dcoefficients) const;
+
+  /// Whether the residual is the bounded one, which is converged on the Newton step instead
+  bool useBoundedResidual() const;
+
+  /// Whether a step from the given trial state is elastic
+  bool elastic(const T & effective_trial_stress, const T & hardening_old) const;
+
+  /**
+   * von Mises stress at the given fraction of the linear path from the old to the trial stress,
+   * and its derivatives with respect to the effective trial stress at a fixed trial direction and
+   * to the projected old stress
+   */
+  T rampedStress(const T & effective_stress_old,
+                 const T & projected_stress_old,
+                 const T & effective_trial_stress,
+                 const Real fraction,
+                 Real & dramped_dtrial_stress,
+                 Real & dramped_dprojected_stress) const;
+
+  /**
+   * Add the derivatives of a converged substep increment to the derivatives of the summed
+   * increment, which enters the substep through its trial stress and its start strain, and to
+   * those along the coefficient derivatives
+   * @param dramped_dtrial_stress derivative of the ramped stress of the substep
+   * @param dramped_dprojected_stress derivative of the ramped stress of the substep
+   * @param previous_scalar summed increment of the previous substeps
+   */
+  void chainSubstepDerivatives(const T & substep_trial_stress,
+                               const T & three_shear_modulus,
+                               const T & substep_strain_old,
+                               const Real substep_dt,
+                               const T & substep_scalar,
+                               const Real dramped_dtrial_stress,
+                               const Real dramped_dprojected_stress,
+                               const Real previous_scalar);
+
+  unsigned int _iterations = 0;
+  unsigned int _substeps = 1;
+
+  ///@{ Derivatives of the summed increment of solveSubstepped
+  Real _dscalar_dtrial_stress = 0.0;
+  Real _dscalar_dprojected_stress = 0.0;
+  Real _dscalar_dthree_shear_modulus = 0.0;
+  std::vector<Real> _dscalar_dcoefficients;
+  ///@}
+};
+
+template <typename T, typename FlowLaw, typename Hardening>
+bool
+ViscoplasticReturnMapping<T, FlowLaw, Hardening>::useBoundedResidual() const
+{
+  if constexpr (FlowLaw::has_bounded_residual)
+    return bounded_residual;
+  else
+    return false;
+}
+
+template <typename T, typename FlowLaw, typename Hardening>
+bool
+ViscoplasticReturnMapping<T, FlowLaw, Hardening>::elastic(const T & effective_trial_stress,
+                                                          const T & hardening_old) const
+{
+  if (!FlowLaw::hasThreshold(flow))
+    return MetaPhysicL::raw_value(effective_trial_stress) <= 0.0;
+
+  return MetaPhysicL::raw_value(effective_trial_stress - hardening_old) <= yield_stress;
+}
+
+template <typename T, typename FlowLaw, typename Hardening>
+void
+ViscoplasticReturnMapping<T, FlowLaw, Hardening>::computeResidual(const T & effective_trial_stress,
+                                                                  const T & three_shear_modulus,
+                                                                  const T & strain_old,
+                                                                  const Real dt,
+                                                                  const T & scalar,
+                                                                  T & hardening,
+                                                                  T & residual,
+                                                                  T & derivative,
+                                                                  T * dresidual_dtrial_stress,
+                                                                  T * dresidual_dstrain_old) const
+{
+  T slope;
+  Hardening::evaluate(T(strain_old + scalar), hardening_law, hardening, slope);
+
+  const T effective_stress = effective_trial_stress - three_shear_modulus * scalar;
+  const T flow_stress = hardening + yield_stress;
+
+  if constexpr (FlowLaw::has_bounded_residual)
+    if (bounded_residual)
+    {
+      const auto bounded =
+          FlowLaw::template evaluateBounded<T>(effective_stress, flow_stress, T(scalar / dt), flow);
+      residual = bounded.residual;
+      derivative = -three_shear_modulus * bounded.dresidual_dstress +
+                   bounded.dresidual_dflow_stress * slope + bounded.dresidual_drate / dt;
+      if (dresidual_dtrial_stress)
+        *dresidual_dtrial_stress = bounded.dresidual_dstress;
+      if (dresidual_dstrain_old)
+        *dresidual_dstrain_old = bounded.dresidual_dflow_stress * slope;
+      return;
+    }
+
+  const auto flow_rate = FlowLaw::template evaluate<T>(effective_stress, flow_stress, flow);
+  ViscoplasticFlowLaws::radialReturnResidual(
+      flow_rate, slope, three_shear_modulus, dt, scalar, residual, derivative);
+  if (dresidual_dtrial_stress)
+    *dresidual_dtrial_stress = flow_rate.drate_dstress * dt;
+  if (dresidual_dstrain_old)
+    *dresidual_dstrain_old = flow_rate.drate_dflow_stress * slope * dt;
+}
+
+template <typename T, typename FlowLaw, typename Hardening>
+T
+ViscoplasticReturnMapping<T, FlowLaw, Hardening>::residualCoefficientDerivative(
+    const T & effective_trial_stress,
+    const T & three_shear_modulus,
+    const T & strain_old,
+    const Real dt,
+    const T & scalar,
+    const CoefficientDerivatives & dcoefficients) const
+{
+  const T strain = strain_old + scalar;
+  T hardening, slope, dhardening, dslope;
+  Hardening::evaluate(strain, hardening_law, hardening, slope);
+  Hardening::coefficientDerivative(
+      strain, hardening_law, dcoefficients.hardening_law, dhardening, dslope);
+
+  const T effective_stress = effective_trial_stress - three_shear_modulus * scalar;
+  const T flow_stress = hardening + yield_stress;
+  const T dflow_stress = dhardening + dcoefficients.yield_stress;
+
+  if constexpr (FlowLaw::has_bounded_residual)
+    if (bounded_residual)
+      return FlowLaw::template boundedCoefficientDerivative<T>(
+          effective_stress, flow_stress, T(scalar / dt), flow, dcoefficients.flow, dflow_stress);
+
+  return FlowLaw::template coefficientDerivative<T>(
+             effective_stress, flow_stress, flow, dcoefficients.flow, dflow_stress)
+             .rate *
+         dt;
+}
+
+template <typename T, typename FlowLaw, typename Hardening>
+bool
+ViscoplasticReturnMapping<T, FlowLaw, Hardening>::explicitStep(const T & effective_trial_stress,
+                                                               const T & three_shear_modulus,
+                                                               const T & strain_old,
+                                                               const T & hardening_old,
+                                                               const Real dt,
+                                                               const Real error_tolerance,
+                                                               T & scalar,
+                                                               T & hardening,
+                                                               Real & error) const
+{
+  using MetaPhysicL::raw_value;
+
+  scalar = 0.0;
+  hardening = hardening_old;
+  error = 0.0;
+  if (elastic(effective_trial_stress, hardening_old))
+    return true;
+
+  // the rate form of the residual at zero is the forward Euler increment
+  T slope;
+  Hardening::evaluate(strain_old, hardening_law, hardening, slope);
+  const auto flow_rate =
+      FlowLaw::template evaluate<T>(effective_trial_stress, T(hardening + yield_stress), flow);
+  T forward_euler, derivative;
+  ViscoplasticFlowLaws::radialReturnResidual(
+      flow_rate, slope, three_shear_modulus, dt, T(0.0), forward_euler, derivative);
+
+  // one Newton step from zero, and its distance to the forward Euler increment
+  scalar = -forward_euler / derivative;
+  error = std::abs(raw_value(forward_euler - scalar));
+
+  const Real upper = raw_value(effective_trial_stress) / raw_value(three_shear_modulus);
+  if (!std::isfinite(raw_value(scalar)) || !std::isfinite(error) || error > error_tolerance ||
+      !(raw_value(scalar) >= 0.0 && raw_value(scalar) < upper))
+  {
+    scalar = 0.0;
+    hardening = hardening_old;
+    return false;
+  }
+
+  Hardening::evaluate(T(strain_old + scalar), hardening_law, hardening, slope);
+  return true;
+}
+
+template <typename T, typename FlowLaw, typename Hardening>
+T
+ViscoplasticReturnMapping<T, FlowLaw, Hardening>::explicitStepCoefficientDerivative(
+    const T & effective_trial_stress,
+    const T & three_shear_modulus,
+    const T & strain_old,
+    const Real dt,
+    const CoefficientDerivatives & dcoefficients) const
+{
+  T hardening, slope, dhardening, dslope;
+  Hardening::evaluate(strain_old, hardening_law, hardening, slope);
+  Hardening::coefficientDerivative(
+      strain_old, hardening_law, dcoefficients.hardening_law, dhardening, dslope);
+
+  const T flow_stress = hardening + yield_stress;
+  const T dflow_stress = dhardening + dcoefficients.yield_stress;
+  const auto flow_rate = FlowLaw::template evaluate<T>(effective_trial_stress, flow_stress, flow);
+  const auto dflow_rate = FlowLaw::template coefficientDerivative<T>(
+      effective_trial_stress, flow_stress, flow, dcoefficients.flow, dflow_stress);
+  T forward_euler, derivative;
+  ViscoplasticFlowLaws::radialReturnResidual(
+      flow_rate, slope, three_shear_modulus, dt, T(0.0), forward_euler, derivative);
+
+  // scalar = -forward_euler / derivative, with both changing along the coefficients
+  const T scalar = -forward_euler / derivative;
+  const T dforward_euler = dflow_rate.rate * dt;
+  const T dderivative = (-three_shear_modulus * dflow_rate.drate_dstress +
+                         dflow_rate.drate_dflow_stress * slope +
+                         flow_rate.drate_dflow_stress * dslope) *
+                        dt;
+  const T dscalar = -(dforward_euler + scalar * dderivative) / derivative;
+  if (!std::isfinite(MetaPhysicL::raw_value(dscalar)))
+    return 0.0;
+  return dscalar;
+}
+
+template <typename T, typename FlowLaw, typename Hardening>
+T
+ViscoplasticReturnMapping<T, FlowLaw, Hardening>::incrementStressDerivative(
+    const T & effective_trial_stress,
+    const T & three_shear_modulus,
+    const T & strain_old,
+    const Real dt,
+    const T & scalar) const
+{
+  if (scalar <= 0.0)
+    return 0.0;
+
+  T hardening, residual, derivative, dresidual_dtrial_stress;
+  computeResidual(effective_trial_stress,
+                  three_shear_modulus,
+                  strain_old,
+                  dt,
+                  scalar,
+                  hardening,
+                  residual,
+                  derivative,
+                  &dresidual_dtrial_stress);
+
+  // implicit function theorem on r(scalar, trial stress) = 0
+  const T dscalar_dtrial_stress = -dresidual_dtrial_stress / derivative;
+  if (!std::isfinite(MetaPhysicL::raw_value(dscalar_dtrial_stress)))
+    return 0.0;
+  return dscalar_dtrial_stress;
+}
+
+template <typename T, typename FlowLaw, typename Hardening>
+bool
+ViscoplasticReturnMapping<T, FlowLaw, Hardening>::solve(const T & effective_trial_stress,
+                                                        const T & three_shear_modulus,
+                                                        const T & strain_old,
+                                                        const T & hardening_old,
+                                                        const Real dt,
+                                                        T & scalar,
+                                                        T & hardening)
+{
+  using MetaPhysicL::raw_value;
+
+  _iterations = 0;
+  scalar = 0.0;
+  hardening = hardening_old;
+  if (elastic(effective_trial_stress, hardening_old))
+    return true;
+
+  // the residual decreases monotonically in the increment, so its sign brackets the root
+  Real lower = 0.0;
+  Real upper = raw_value(effective_trial_stress) / raw_value(three_shear_modulus);
+  const bool bounded = useBoundedResidual();
+
+  const Real initial_guess = initial_rate * dt;
+  if (initial_guess > 0.0 && initial_guess < upper)
+    scalar = initial_guess;
+
+  T residual, derivative;
+  computeResidual(effective_trial_stress,
+                  three_shear_modulus,
+                  strain_old,
+                  dt,
+                  scalar,
+                  hardening,
+                  residual,
+                  derivative);
+
+  for (; _iterations < max_its; ++_iterations)
+  {
+    // the bounded residual is not in strain units, its Newton step is
+    const Real raw_residual =
+        bounded ? raw_value(residual) / std::abs(raw_value(derivative)) : raw_value(residual);
+    const Real reference_residual =
+        raw_value(effective_trial_stress) / raw_value(three_shear_modulus) - raw_value(scalar);
+    if (std::abs(raw_residual) <= absolute_tolerance ||
+        std::abs(raw_residual) <= relative_tolerance * std::abs(reference_residual))
+    {
+      // a final Newton correction gives AD iterates the derivatives of the converged increment,
+      // which bisection steps do not carry
+      if constexpr (!std::is_same<T, Real>::value)
+      {
+        scalar -= residual / derivative;
+        computeResidual(effective_trial_stress,
+                        three_shear_modulus,
+                        strain_old,
+                        dt,
+                        scalar,
+                        hardening,
+                        residual,
+                        derivative);
+      }
+      return true;
+    }
+
+    // an overflowed rate is bracketed by its sign, while a NaN residual comes from a fractional
+    // power law exponent below the flow stress, which only happens beyond the root
+    if (raw_residual > 0.0)
+      lower = raw_value(scalar);
+    else
+      upper = raw_value(scalar);
+
+    scalar -= residual / derivative;
+    if (!(raw_value(scalar) > lower && raw_value(scalar) < upper))
+      scalar = 0.5 * (lower + upper);
+
+    computeResidual(effective_trial_stress,
+                    three_shear_modulus,
+                    strain_old,
+                    dt,
+                    scalar,
+                    hardening,
+                    residual,
+                    derivative);
+  }
+
+  return false;
+}
+
+template <typename T, typename FlowLaw, typename Hardening>
+T
+ViscoplasticReturnMapping<T, FlowLaw, Hardening>::rampedStress(
+    const T & effective_stress_old,
+    const T & projected_stress_old,
+    const T & effective_trial_stress,
+    const Real fraction,
+    Real & dramped_dtrial_stress,
+    Real & dramped_dprojected_stress) const
+{
+  using MetaPhysicL::raw_value;
+
+  if (fraction == 1.0)
+  {
+    dramped_dtrial_stress = 1.0;
+    dramped_dprojected_stress = 0.0;
+    return effective_trial_stress;
+  }
+
+  // squared norm of the interpolated deviatoric stress, with the trial stress scaled at a fixed
+  // direction its cross term with the old stress is proportional to the effective trial stress
+  const Real old_fraction = 1.0 - fraction;
+  const T squared = old_fraction * old_fraction * effective_stress_old * effective_stress_old +
+                    2.0 * fraction * old_fraction * projected_stress_old * effective_trial_stress +
+                    fraction * fraction * effective_trial_stress * effective_trial_stress;
+  if (raw_value(squared) <= 0.0)
+  {
+    dramped_dtrial_stress = fraction;
+    dramped_dprojected_stress = 0.0;
+    return T(0.0);
+  }
+
+  const T ramped = std::sqrt(squared);
+  dramped_dtrial_stress = raw_value(fraction * old_fraction * projected_stress_old +
+                                    fraction * fraction * effective_trial_stress) /
+                          raw_value(ramped);
+  dramped_dprojected_stress =
+      raw_value(fraction * old_fraction * effective_trial_stress) / raw_value(ramped);
+  return ramped;
+}
+
+template <typename T, typename FlowLaw, typename Hardening>
+void
+ViscoplasticReturnMapping<T, FlowLaw, Hardening>::chainSubstepDerivatives(
+    const T & substep_trial_stress,
+    const T & three_shear_modulus,
+    const T & substep_strain_old,
+    const Real substep_dt,
+    const T & substep_scalar,
+    const Real dramped_dtrial_stress,
+    const Real dramped_dprojected_stress,
+    const Real previous_scalar)
+{
+  using MetaPhysicL::raw_value;
+
+  // the substep trial stress is the ramped stress relieved by the previous increments
+  const Real three_g = raw_value(three_shear_modulus);
+  const Real dtrial_dtrial_stress = dramped_dtrial_stress - three_g * _dscalar_dtrial_stress;
+  const Real dtrial_dprojected_stress =
+      dramped_dprojected_stress - three_g * _dscalar_dprojected_stress;
+  const Real dtrial_dthree_shear_modulus =
+      -previous_scalar - three_g * _dscalar_dthree_shear_modulus;
+  if (raw_value(substep_scalar) <= 0.0)
+    return;
+
+  T hardening, residual, derivative, dresidual_dtrial_stress, dresidual_dstrain_old;
+  computeResidual(substep_trial_stress,
+                  three_shear_modulus,
+                  substep_strain_old,
+                  substep_dt,
+                  substep_scalar,
+                  hardening,
+                  residual,
+                  derivative,
+                  &dresidual_dtrial_stress,
+                  &dresidual_dstrain_old);
+
+  // implicit function theorem on the substep residual r(scalar, trial stress, 3G, strain old),
+  // where 3G also enters directly through the effective stress trial stress - 3G scalar
+  const Real r_scalar = raw_value(derivative);
+  const Real r_stress = raw_value(dresidual_dtrial_stress);
+  const Real r_strain = raw_value(dresidual_dstrain_old);
+  const Real dsubstep_dtrial_stress =
+      -(r_stress * dtrial_dtrial_stress + r_strain * _dscalar_dtrial_stress) / r_scalar;
+  const Real dsubstep_dprojected_stress =
+      -(r_stress * dtrial_dprojected_stress + r_strain * _dscalar_dprojected_stress) / r_scalar;
+  const Real dsubstep_dthree_shear_modulus =
+      -(r_stress * (dtrial_dthree_shear_modulus - raw_value(substep_scalar)) +
+        r_strain * _dscalar_dthree_shear_modulus) /
+      r_scalar;
+  if (std::isfinite(dsubstep_dtrial_stress) && std::isfinite(dsubstep_dprojected_stress) &&
+      std::isfinite(dsubstep_dthree_shear_modulus))
+  {
+    _dscalar_dtrial_stress += dsubstep_dtrial_stress;
+    _dscalar_dprojected_stress += dsubstep_dprojected_stress;
+    _dscalar_dthree_shear_modulus += dsubstep_dthree_shear_modulus;
+  }
+
+  // the coefficients enter directly and through the previous increments, which relieve the
+  // substep trial stress and advance its start strain
+  for (unsigned int i = 0; i < coefficient_derivatives.size(); ++i)
+  {
+    const Real r_coefficient = raw_value(residualCoefficientDerivative(substep_trial_stress,
+                                                                       three_shear_modulus,
+                                                                       substep_strain_old,
+                                                                       substep_dt,
+                                                                       substep_scalar,
+                                                                       coefficient_derivatives[i]));
+    const Real dsubstep_dcoefficient =
+        -(r_coefficient + (r_strain - r_stress * three_g) * _dscalar_dcoefficients[i]) / r_scalar;
+    if (std::isfinite(dsubstep_dcoefficient))
+      _dscalar_dcoefficients[i] += dsubstep_dcoefficient;
+  }
+}
+
+template <typename T, typename FlowLaw, typename Hardening>
+bool
+ViscoplasticReturnMapping<T, FlowLaw, Hardening>::solveSubstepped(const T & effective_stress_old,
+                                                                  const T & projected_stress_old,
+                                                                  const T & effective_trial_stress,
+                                                                  const T & three_shear_modulus,
+                                                                  const T & strain_old,
+                                                                  const T & hardening_old,
+                                                                  const Real dt,
+                                                                  T & scalar,
+                                                                  T & hardening)
+{
+  unsigned int total_iterations = 0;
+
+  for (_substeps = 1; _substeps <= std::max(max_substeps, 1u); _substeps *= 2)
+  {
+    scalar = 0.0;
+    hardening = hardening_old;
+    _dscalar_dtrial_stress = 0.0;
+    _dscalar_dprojected_stress = 0.0;
+    _dscalar_dthree_shear_modulus = 0.0;
+    _dscalar_dcoefficients.assign(coefficient_derivatives.size(), 0.0);
+
+    bool converged = true;
+    for (unsigned int i = 1; i <= _substeps && converged; ++i)
+    {
+      // trial stress of the substep, relieved by the increments of the previous substeps
+      const Real fraction = static_cast<Real>(i) / _substeps;
+      Real dramped_dtrial_stress, dramped_dprojected_stress;
+      const T substep_trial_stress = rampedStress(effective_stress_old,
+                                                  projected_stress_old,
+                                                  effective_trial_stress,
+                                                  fraction,
+                                                  dramped_dtrial_stress,
+                                                  dramped_dprojected_stress) -
+                                     three_shear_modulus * scalar;
+      const T substep_strain_old = strain_old + scalar;
+
+      T substep_scalar;
+      const T substep_hardening_old = hardening;
+      converged = solve(substep_trial_stress,
+                        three_shear_modulus,
+                        substep_strain_old,
+                        substep_hardening_old,
+                        dt / _substeps,
+                        substep_scalar,
+                        hardening);
+      total_iterations += _iterations;
+      if (converged)
+        chainSubstepDerivatives(substep_trial_stress,
+                                three_shear_modulus,
+                                substep_strain_old,
+                                dt / _substeps,
+                                substep_scalar,
+                                dramped_dtrial_stress,
+                                dramped_dprojected_stress,
+                                MetaPhysicL::raw_value(scalar));
+      scalar += substep_scalar;
+    }
+
+    if (converged)
+    {
+      _iterations = total_iterations;
+      return true;
+    }
+  }
+
+  _iterations = total_iterations;
+  _substeps /= 2;
+  return false;
+}
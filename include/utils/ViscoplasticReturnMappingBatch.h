@@ -0,0 +1,226 @@
+#pragma once
+
+#include "ViscoplasticReturnMapping.h"
+
+#include <vector>
+
+/**
+ * Block of scalar radial return problems, typically the plastic quadrature points of an element,
+ * that are solved together. Every point keeps the ViscoplasticReturnMapping it was added with,
+ * which holds its coefficients and convergence controls, while the iteration state of the block is
+ * stored as structure-of-arrays.
+ *
+ * solve() advances all points by the same iteration in lockstep. Each point takes exactly the
+ * iterates of ViscoplasticReturnMapping::solve(), with the same residual kernel, bracket
+ * safeguards and convergence check, so that converged points are masked out and the block returns
+ * the increments of the scalar solves. The residual evaluations of the points of one iteration are
+ * independent of each other, which lets their transcendental functions overlap instead of waiting
+ * on the previous Newton step of the same point.
+ *
+ * Points that do not converge within max_its are flagged, they are left to the substepping of
+ * ViscoplasticReturnMapping::solveSubstepped().
+ */
+template <typename FlowLaw, typename Hardening>
+class ViscoplasticReturnMappingBatch
+{
+public:
+  typedef ViscoplasticReturnMapping<Real, FlowLaw, Hardening> ReturnMapping;
+
+  /// Remove all points, keeping the storage for the next block
+  void clear() { _size = 0; }
+
+  /// Number of points in the block
+  std::size_t size() const { return _size; }
+
+  /**
+   * Add a point with the coefficients, convergence controls and initial rate of return_mapping
+   * @return index of the point in the block
+   */
+  std::size_t add(const ReturnMapping & return_mapping,
+                  const Real effective_trial_stress,
+                  const Real three_shear_modulus,
+                  const Real strain_old,
+                  const Real hardening_old);
+
+  /**
+   * Solve all points of the block over the time step dt
+   * @return true if every point converged
+   */
+  bool solve(const Real dt);
+
+  ///@{ Solution of point i of the last solve
+  Real scalar(const std::size_t i) const { return _scalar[i]; }
+  Real hardening(const std::size_t i) const { return _hardening[i]; }
+  bool converged(const std::size_t i) const { return _state[i] == CONVERGED; }
+  unsigned int iterations(const std::size_t i) const { return _iterations[i]; }
+  ///@}
+
+protected:
+  /// Iteration state of a point
+  enum State : unsigned char
+  {
+    ACTIVE,
+    CONVERGED,
+    FAILED
+  };
+
+  /// Evaluate the residual of every active point at its current iterate
+  void computeResiduals(const Real dt);
+
+  std::size_t _size = 0;
+
+  /// Return mappings holding the coefficients and convergence controls of the points
+  std::vector<ReturnMapping> _return_mappings;
+
+  ///@{ Inputs of the points
+  std::vector<Real> _effective_trial_stress;
+  std::vector<Real> _three_shear_modulus;
+  std::vector<Real> _strain_old;
+  std::vector<Real> _hardening_old;
+  ///@}
+
+  ///@{ Iterates and solutions of the points
+  std::vector<Real> _scalar;
+  std::vector<Real> _hardening;
+  std::vector<unsigned int> _iterations;
+  std::vector<State> _state;
+  ///@}
+
+  ///@{ Residual, its derivative and the bracket of the root at the current iterates
+  std::vector<Real> _residual;
+  std::vector<Real> _derivative;
+  std::vector<Real> _lower;
+  std::vector<Real> _upper;
+  ///@}
+};
+
+template <typename FlowLaw, typename Hardening>
+std::size_t
+ViscoplasticReturnMappingBatch<FlowLaw, Hardening>::add(const ReturnMapping & return_mapping,
+                                                        const Real effective_trial_stress,
+                                                        const Real three_shear_modulus,
+                                                        const Real strain_old,
+                                                        const Real hardening_old)
+{
+  // the storage of earlier blocks is overwritten rather than reallocated
+  if (_size == _return_mappings.size())
+  {
+    const std::size_t capacity = _size + 1;
+    _return_mappings.resize(capacity);
+    for (auto * values : {&_effective_trial_stress,
+                          &_three_shear_modulus,
+                          &_strain_old,
+                          &_hardening_old,
+                          &_scalar,
+                          &_hardening,
+                          &_residual,
+                          &_derivative,
+                          &_lower,
+                          &_upper})
+      values->resize(capacity);
+    _iterations.resize(capacity);
+    _state.resize(capacity);
+  }
+
+  const std::size_t i = _size++;
+  _return_mappings[i] = return_mapping;
+  _effective_trial_stress[i] = effective_trial_stress;
+  _three_shear_modulus[i] = three_shear_modulus;
+  _strain_old[i] = strain_old;
+  _hardening_old[i] = hardening_old;
+  return i;
+}
+
+template <typename FlowLaw, typename Hardening>
+void
+ViscoplasticReturnMappingBatch<FlowLaw, Hardening>::computeResiduals(const Real dt)
+{
+  for (std::size_t i = 0; i < _size; ++i)
+    if (_state[i] == ACTIVE)
+      _return_mappings[i].computeResidual(_effective_trial_stress[i],
+                                          _three_shear_modulus[i],
+                                          _strain_old[i],
+                                          dt,
+                                          _scalar[i],
+                                          _hardening[i],
+                                          _residual[i],
+                                          _derivative[i]);
+}
+
+template <typename FlowLaw, typename Hardening>
+bool
+ViscoplasticReturnMappingBatch<FlowLaw, Hardening>::solve(const Real dt)
+{
+  std::size_t num_active = 0;
+  for (std::size_t i = 0; i < _size; ++i)
+  {
+    const ReturnMapping & return_mapping = _return_mappings[i];
+    _iterations[i] = 0;
+    _scalar[i] = 0.0;
+    _hardening[i] = _hardening_old[i];
+    if (return_mapping.elastic(_effective_trial_stress[i], _hardening_old[i]))
+    {
+      _state[i] = CONVERGED;
+      continue;
+    }
+
+    _state[i] = ACTIVE;
+    ++num_active;
+    _lower[i] = 0.0;
+    _upper[i] = _effective_trial_stress[i] / _three_shear_modulus[i];
+    const Real initial_guess = return_mapping.initial_rate * dt;
+    if (initial_guess > 0.0 && initial_guess < _upper[i])
+      _scalar[i] = initial_guess;
+  }
+
+  computeResiduals(dt);
+
+  // the iteration of ViscoplasticReturnMapping::solve, with its loop over the points moved inside
+  for (unsigned int iteration = 0; num_active > 0; ++iteration)
+  {
+    for (std::size_t i = 0; i < _size; ++i)
+    {
+      if (_state[i] != ACTIVE)
+        continue;
+
+      const ReturnMapping & return_mapping = _return_mappings[i];
+      if (iteration == return_mapping.max_its)
+      {
+        _state[i] = FAILED;
+        --num_active;
+        continue;
+      }
+
+      const Real raw_residual = return_mapping.useBoundedResidual()
+                                    ? _residual[i] / std::abs(_derivative[i])
+                                    : _residual[i];
+      const Real reference_residual =
+          _effective_trial_stress[i] / _three_shear_modulus[i] - _scalar[i];
+      if (std::abs(raw_residual) <= return_mapping.absolute_tolerance ||
+          std::abs(raw_residual) <=
+              return_mapping.relative_tolerance * std::abs(reference_residual))
+      {
+        _state[i] = CONVERGED;
+        --num_active;
+        continue;
+      }
+
+      ++_iterations[i];
+      if (raw_residual > 0.0)
+        _lower[i] = _scalar[i];
+      else
+        _upper[i] = _scalar[i];
+
+      _scalar[i] -= _residual[i] / _derivative[i];
+      if (!(_scalar[i] > _lower[i] && _scalar[i] < _upper[i]))
+        _scalar[i] = 0.5 * (_lower[i] + _upper[i]);
+    }
+
+    computeResiduals(dt);
+  }
+
+  for (std::size_t i = 0; i < _size; ++i)
+    if (_state[i] == FAILED)
+      return false;
+  return true;
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+#include "GeneralVectorPostprocessor.h"
+
+#include <set>
+
+/**
+ * ReturnMappingStatistics collects statistics of the local return mapping solves of the sloth
+ * stress updates that name it in their return_mapping_statistics parameter: a histogram of the
+ * local Newton iterations, the number of elastic and plastic quadrature point updates, how many of
+ * the plastic updates were taken by the explicit step instead of the return mapping, the hits of
+ * the return mapping cache, the largest
+ * converged residual, and the failed solves together with the global time step cutbacks they
+ * caused. All statistics are broken down per mesh block, with one row per block.
+ *
+ * Stress updates record into per thread slots without any locking. Threads and MPI ranks are only
+ * reduced when the vectors are computed, after which the slots are cleared, so each output covers
+ * the material evaluations since the previous one.
+ */
+class ReturnMappingStatistics : public GeneralVectorPostprocessor
+{
+public:
+  static InputParameters validParams();
+
+  ReturnMappingStatistics(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void finalize() override;
+
+  /**
+   * Record a converged return mapping solve
+   * @param tid thread of the calling material
+   * @param block subdomain of the current element
+   * @param iterations number of local Newton iterations, zero for an elastic update
+   * @param residual absolute value of the converged residual
+   * @param plastic whether the update produced inelastic strain
+   * @param explicit_update whether a plastic update was taken by the explicit step, which is not
+   * part of the iteration statistics
+   */
+  void recordSolve(const THREAD_ID tid,
+                   const SubdomainID block,
+                   const unsigned int iterations,
+                   const Real residual,
+                   const bool plastic,
+                   const bool explicit_update = false) const;
+
+  /**
+   * Record a lookup in the return mapping cache. A hit replaces the solve, which is not recorded by
+   * recordSolve.
+   */
+  void recordCacheLookup(const THREAD_ID tid, const SubdomainID block, const bool hit) const;
+
+  /**
+   * Record a failed return mapping solve. Failures at the same time belong to the same attempt of
+   * a time step, each distinct time is counted as one cutback.
+   */
+  void recordFailure(const THREAD_ID tid, const SubdomainID block, const Real time) const;
+
+protected:
+  /// Statistics of one block on one thread, aligned to keep threads off each other's cache lines
+  struct alignas(64) Slot
+  {
+    unsigned long elastic_points = 0;
+    unsigned long plastic_points = 0;
+    unsigned long explicit_points = 0;
+    unsigned long cache_lookups = 0;
+    unsigned long cache_hits = 0;
+    unsigned long failures = 0;
+    unsigned long total_iterations = 0;
+    unsigned int max_iterations = 0;
+    Real max_residual = 0.0;
+    std::vector<unsigned long> histogram;
+    std::set<Real> failure_times;
+  };
+
+  /// Slot of a block on a thread
+  Slot & slot(const THREAD_ID tid, const SubdomainID block) const;
+
+  /// Number of histogram bins, the last bin collects all larger iteration counts
+  const unsigned int _bins;
+
+  /// Mesh blocks, in the order of the output rows
+  const std::vector<SubdomainID> _block_ids;
+
+  /// Per thread, per block statistics, written by the materials during the material evaluation
+  mutable std::vector<std::vector<Slot>> _slots;
+
+  ///@{ Output vectors with one entry per block
+  VectorPostprocessorValue & _block;
+  VectorPostprocessorValue & _elastic_points;
+  VectorPostprocessorValue & _plastic_points;
+  VectorPostprocessorValue & _explicit_points;
+  VectorPostprocessorValue & _implicit_fraction;
+  VectorPostprocessorValue & _cache_hits;
+  VectorPostprocessorValue & _cache_hit_rate;
+  VectorPostprocessorValue & _mean_iterations;
+  VectorPostprocessorValue & _max_iterations;
+  VectorPostprocessorValue & _max_residual;
+  VectorPostprocessorValue & _failures;
+  VectorPostprocessorValue & _cutbacks;
+  std::vector<VectorPostprocessorValue *> _histogram;
+  ///@}
+
+  /// Total iterations per block, reduced alongside the output vectors
+  std::vector<Real> _total_iterations;
+
+  /// Cache lookups per block, reduced alongside the output vectors
+  std::vector<Real> _cache_lookups;
+
+  /// Failure times per block, reduced alongside the output vectors
+  std::vector<std::set<Real>> _failure_times;
+};
@@ -0,0 +1,161 @@
+#!/usr/bin/env python3
+"""
+Strong and weak scaling study of the sloth viscoplastic models.
+
+Runs the inputs in test/tests/scaling over every combination of MPI ranks and threads, reads the
+PerfGraphReporter timings from the JSON output of each run and writes one CSV row per run with the
+time spent in material evaluation, the rest of residual and Jacobian assembly and the rest of the
+solve, together with the speedup and parallel efficiency against the smallest run of the model.
+
+Strong scaling keeps the mesh at --elements per side for every process count, weak scaling grows
+the mesh so that the number of elements per process stays that of the smallest run.
+
+  ./scripts/scaling_study.py --ranks 1 2 4 8 --threads 1 2 --elements 32 --output scaling.csv
+"""
+
+import argparse
+import csv
+import itertools
+import json
+import os
+import shutil
+import subprocess
+import sys
+import time
+
+SCALING_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'test', 'tests',
+                           'scaling')
+MODELS = ('hsv', 'sinh', 'perzyna', 'composite', 'krdamage')
+
+# PerfGraph sections attributed to each category, matched as substrings of the section names. The
+# self time of every section goes to the innermost category of its branch, so material evaluation
+# within assembly and assembly within the solve are each counted once.
+CATEGORIES = {
+    'materials': ('Material',),
+    'assembly': ('computeResidual', 'computeJacobian'),
+    'solve': ('solve',),
+}
+
+
+def find_executable(repo_dir):
+    for method in ('opt', 'oprof', 'devel', 'dbg'):
+        path = os.path.join(repo_dir, 'sloth-' + method)
+        if os.path.exists(path):
+            return path
+    return None
+
+
+def perf_graph_root(data):
+    """Return the root node of the PerfGraphReporter graph in a MOOSE JSON output"""
+    for step in reversed(data.get('time_steps', [])):
+        for name, value in step.items():
+            if isinstance(value, dict) and 'graph' in value:
+                return value['graph']
+    raise RuntimeError('No PerfGraphReporter output found')
+
+
+def children(node):
+    return [(name, child) for name, child in node.items() if isinstance(child, dict)]
+
+
+def attribute(node, name, category, timings):
+    """Add the self time of node and its descendants to their categories in timings"""
+    for candidate, patterns in CATEGORIES.items():
+        if any(pattern in name for pattern in patterns):
+            category = candidate
+            break
+    timings[category] += node.get('time', 0.0)
+    timings['total'] += node.get('time', 0.0)
+    for child_name, child in children(node):
+        attribute(child, child_name, category, timings)
+
+
+def run_case(executable, mpiexec, model, ranks, threads, elements, end_time, workdir):
+    prefix = '{}_r{}_t{}_n{}'.format(model, ranks, threads, elements)
+    command = [mpiexec, '-n', str(ranks)] if ranks > 1 else []
+    command += [executable, '-i', os.path.join(SCALING_DIR, model + '.i'),
+                '--n-threads={}'.format(threads), 'n={}'.format(elements),
+                'end_time={}'.format(end_time), 'Outputs/timing/file_base=' + prefix]
+
+    start = time.time()
+    result = subprocess.run(command, cwd=workdir, stdout=subprocess.PIPE,
+                            stderr=subprocess.STDOUT, universal_newlines=True)
+    wall_time = time.time() - start
+    if result.returncode != 0:
+        sys.stderr.write(result.stdout)
+        raise RuntimeError('{} failed'.format(' '.join(command)))
+
+    with open(os.path.join(workdir, prefix + '.json')) as f:
+        root = perf_graph_root(json.load(f))
+
+    timings = dict.fromkeys(list(CATEGORIES) + ['other', 'total'], 0.0)
+    attribute(root, 'Root', 'other', timings)
+    timings['wall'] = wall_time
+    return timings
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--models', nargs='+', default=MODELS, choices=MODELS)
+    parser.add_argument('--ranks', nargs='+', type=int, default=[1])
+    parser.add_argument('--threads', nargs='+', type=int, default=[1])
+    parser.add_argument('--elements', type=int, default=16,
+                        help='Elements per side of the cube for the smallest process count')
+    parser.add_argument('--mode', choices=('strong', 'weak'), default='strong')
+    parser.add_argument('--end-time', type=float, default=5.0)
+    parser.add_argument('--executable', help='sloth executable, found in the repository if omitted')
+    parser.add_argument('--mpiexec', default='mpiexec')
+    parser.add_argument('--workdir', default='scaling_runs')
+    parser.add_argument('--output', default='scaling.csv')
+    args = parser.parse_args()
+
+    repo_dir = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
+    executable = args.executable or find_executable(repo_dir)
+    if not executable:
+        sys.exit('No sloth executable found, build sloth or pass --executable')
+    if shutil.which(args.mpiexec) is None and max(args.ranks) > 1:
+        sys.exit('{} not found'.format(args.mpiexec))
+    os.makedirs(args.workdir, exist_ok=True)
+
+    fields = ['model', 'mode', 'ranks', 'threads', 'processes', 'elements', 'materials',
+              'assembly', 'solve', 'other', 'total', 'wall', 'speedup', 'efficiency']
+    rows = []
+    smallest = min(args.ranks) * min(args.threads)
+    for model in args.models:
+        reference = None
+        for ranks, threads in sorted(itertools.product(args.ranks, args.threads),
+                                     key=lambda case: case[0] * case[1]):
+            processes = ranks * threads
+            elements = args.elements
+            if args.mode == 'weak':
+                # keep the elements per process constant, the cube grows in all three directions
+                elements = int(round(args.elements * (processes / smallest) ** (1.0 / 3.0)))
+
+            timings = run_case(executable, args.mpiexec, model, ranks, threads, elements,
+                               args.end_time, args.workdir)
+            if reference is None:
+                reference = (timings['total'], processes)
+
+            # weak scaling ideally keeps the time constant, strong scaling divides it
+            speedup = reference[0] / timings['total']
+            if args.mode == 'strong':
+                efficiency = speedup * reference[1] / processes
+            else:
+                efficiency = speedup
+            row = dict(model=model, mode=args.mode, ranks=ranks, threads=threads,
+                       processes=processes, elements=elements, speedup=speedup,
+                       efficiency=efficiency, **timings)
+            rows.append(row)
+            print('{model:>9} {ranks:>3} ranks {threads:>3} threads {elements:>4}^3 elements: '
+                  'materials {materials:8.2f} s, assembly {assembly:8.2f} s, solve {solve:8.2f} s, '
+                  'efficiency {efficiency:5.2f}'.format(**row))
+
+    with open(args.output, 'w', newline='') as f:
+        writer = csv.DictWriter(f, fieldnames=fields)
+        writer.writeheader()
+        writer.writerows(rows)
+
+
+if __name__ == '__main__':
+    main()
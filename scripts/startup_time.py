@@ -0,0 +1,64 @@
+#!/usr/bin/env python3
+"""
+Startup time of sloth executables, for comparing builds with a different module registration.
+
+Each executable parses and checks an input without solving it, which covers the construction of
+the application with the registration of all its objects, the input parsing and the problem setup,
+the fixed cost of every short calibration or parameter sweep run. The runs of the executables are
+interleaved so that file system caching and machine load affect all of them alike.
+
+  ./scripts/startup_time.py --executables ../sloth-all/sloth-opt ./sloth-opt --repeat 20
+"""
+
+import argparse
+import os
+import statistics
+import subprocess
+import sys
+import time
+
+DEFAULT_INPUT = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'test', 'tests',
+                             'scaling', 'sinh.i')
+
+
+def time_run(executable, input_file):
+    command = [executable, '-i', input_file, '--check-input']
+    start = time.time()
+    result = subprocess.run(command, stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                            universal_newlines=True)
+    elapsed = time.time() - start
+    if result.returncode != 0:
+        sys.stderr.write(result.stdout)
+        raise RuntimeError('{} failed'.format(' '.join(command)))
+    return elapsed
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--executables', nargs='+', required=True)
+    parser.add_argument('--input', default=DEFAULT_INPUT)
+    parser.add_argument('--repeat', type=int, default=10)
+    args = parser.parse_args()
+
+    # one untimed run each, the first start of a binary also pays for loading it from disk
+    for executable in args.executables:
+        time_run(executable, args.input)
+
+    times = {executable: [] for executable in args.executables}
+    for _ in range(args.repeat):
+        for executable in args.executables:
+            times[executable].append(time_run(executable, args.input))
+
+    reference = statistics.median(times[args.executables[0]])
+    print('{:<50} {:>10} {:>10} {:>10} {:>8}'.format('executable', 'median', 'min', 'size MB',
+                                                     'ratio'))
+    for executable in args.executables:
+        median = statistics.median(times[executable])
+        size = os.path.getsize(executable) / 1.0e6
+        print('{:<50} {:>10.3f} {:>10.3f} {:>10.1f} {:>8.2f}'.format(
+            executable, median, min(times[executable]), size, median / reference))
+
+
+if __name__ == '__main__':
+    main()
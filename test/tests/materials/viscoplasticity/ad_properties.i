@@ -0,0 +1,86 @@
+# ADHSVStressUpdate with its parameters given as AD material properties of a nonuniform coupled
+# temperature, for the Jacobian with respect to the temperature through the properties. Both blocks
+# of the common mesh carry the same model and the same temperature field.
+!include uniaxial_common.i
+
+[Variables]
+  [temperature]
+    initial_condition = 400
+  []
+[]
+
+[Kernels]
+  [heat_conduction]
+    type = ADDiffusion
+    variable = temperature
+  []
+[]
+
+[BCs]
+  [hot]
+    type = FunctionDirichletBC
+    variable = temperature
+    boundary = left
+    function = '400 + 100 * t'
+  []
+  [cold]
+    type = DirichletBC
+    variable = temperature
+    boundary = right
+    value = 400
+  []
+[]
+
+[Physics/SolidMechanics/QuasiStatic]
+  [all]
+    strain = SMALL
+    incremental = true
+    add_variables = true
+    use_automatic_differentiation = true
+    generate_output = 'stress_xx'
+  []
+[]
+
+[Materials]
+  [elasticity_tensor]
+    type = ADComputeIsotropicElasticityTensor
+    youngs_modulus = 2e5
+    poissons_ratio = 0.3
+  []
+  [stress]
+    type = ADComputeMultipleInelasticStress
+    inelastic_models = viscoplasticity
+  []
+  [yield_stress]
+    type = ADParsedMaterial
+    property_name = yield_stress
+    coupled_variables = temperature
+    expression = '150 - 0.15 * (temperature - 300)'
+  []
+  [sat_stress]
+    type = ADParsedMaterial
+    property_name = sat_stress
+    coupled_variables = temperature
+    expression = '100 - 0.1 * (temperature - 300)'
+  []
+  [c_alpha]
+    type = ADParsedMaterial
+    property_name = c_alpha
+    coupled_variables = temperature
+    expression = '1e-5 * exp(0.01 * (temperature - 300))'
+  []
+  [constant_parameters]
+    type = ADGenericConstantMaterial
+    prop_names = 'exp_rate lin_rate c_beta'
+    prop_values = '20 50 0.05'
+  []
+  [viscoplasticity]
+    type = ADHSVStressUpdate
+    yield_stress = yield_stress
+    sat_stress = sat_stress
+    exp_rate = exp_rate
+    lin_rate = lin_rate
+    c_alpha = c_alpha
+    c_beta = c_beta
+  []
+[]
@@ -0,0 +1,65 @@
+# ADHSVStressUpdate with its parameters interpolated at a nonuniform coupled temperature, for the
+# Jacobian with respect to the temperature. Both blocks of the common mesh carry the same model and
+# the same temperature field.
+!include uniaxial_common.i
+
+[Variables]
+  [temperature]
+    initial_condition = 400
+  []
+[]
+
+[Kernels]
+  [heat_conduction]
+    type = ADDiffusion
+    variable = temperature
+  []
+[]
+
+[BCs]
+  [hot]
+    type = FunctionDirichletBC
+    variable = temperature
+    boundary = left
+    function = '400 + 100 * t'
+  []
+  [cold]
+    type = DirichletBC
+    variable = temperature
+    boundary = right
+    value = 400
+  []
+[]
+
+[Physics/SolidMechanics/QuasiStatic]
+  [all]
+    strain = SMALL
+    incremental = true
+    add_variables = true
+    use_automatic_differentiation = true
+    generate_output = 'stress_xx'
+  []
+[]
+
+[Materials]
+  [elasticity_tensor]
+    type = ADComputeIsotropicElasticityTensor
+    youngs_modulus = 2e5
+    poissons_ratio = 0.3
+  []
+  [stress]
+    type = ADComputeMultipleInelasticStress
+    inelastic_models = viscoplasticity
+  []
+  [viscoplasticity]
+    type = ADHSVStressUpdate
+    temperature = temperature
+    table_temperatures = '300 500 700'
+    table_yield_stress = '150 120 80'
+    table_sat_stress = '100 80 50'
+    table_exp_rate = '20 20 20'
+    table_lin_rate = '50 40 20'
+    table_c_alpha = '1e-5 1e-4 1e-3'
+    table_c_beta = '0.05 0.06 0.08'
+  []
+[]
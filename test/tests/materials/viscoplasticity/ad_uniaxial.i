@@ -0,0 +1,61 @@
+# uniaxial.i with automatic differentiation, ADHSVStressUpdate on the test block against
+# ADSinhViscoplasticityStressUpdate with the same Voce curve on the reference block
+!include uniaxial_common.i
+
+[Physics/SolidMechanics/QuasiStatic]
+  [all]
+    strain = SMALL
+    incremental = true
+    add_variables = true
+    use_automatic_differentiation = true
+    generate_output = 'stress_xx'
+  []
+[]
+
+[Functions]
+  [voce]
+    type = ParsedFunction
+    expression = '100 * (1 - exp(-20 * t)) + 50 * t'
+  []
+[]
+
+[Materials]
+  [parameters]
+    type = ADGenericConstantMaterial
+    prop_names = 'yield_stress sat_stress exp_rate lin_rate c_alpha c_beta'
+    prop_values = '150 100 20 50 1e-5 0.05'
+  []
+  [elasticity_tensor]
+    type = ADComputeIsotropicElasticityTensor
+    youngs_modulus = 2e5
+    poissons_ratio = 0.3
+  []
+  [stress_reference]
+    type = ADComputeMultipleInelasticStress
+    inelastic_models = reference
+    block = reference
+  []
+  [reference]
+    type = ADSinhViscoplasticityStressUpdate
+    yield_stress = 150
+    hardening_function = voce
+    alpha = 1e-5
+    beta = 0.05
+    block = reference
+  []
+  [stress]
+    type = ADComputeMultipleInelasticStress
+    inelastic_models = viscoplasticity
+    block = test
+  []
+  [viscoplasticity]
+    type = ADHSVStressUpdate
+    yield_stress = yield_stress
+    sat_stress = sat_stress
+    exp_rate = exp_rate
+    lin_rate = lin_rate
+    c_alpha = c_alpha
+    c_beta = c_beta
+    block = test
+  []
+[]
@@ -0,0 +1,43 @@
+# uniaxial.i with the return mapping cache, the run fails unless the repeated material evaluations
+# of the nonlinear iterations reused cached solutions
+!include uniaxial.i
+
+[Materials]
+  [viscoplasticity]
+    cache_return_mapping = true
+    return_mapping_statistics = statistics
+  []
+[]
+
+[VectorPostprocessors]
+  [statistics]
+    type = ReturnMappingStatistics
+    outputs = none
+  []
+[]
+
+[Postprocessors]
+  [cache_hits]
+    type = VectorPostprocessorComponent
+    vectorpostprocessor = statistics
+    vector_name = cache_hits
+    index = 0
+    outputs = none
+  []
+  [total_cache_hits]
+    type = CumulativeValuePostprocessor
+    postprocessor = cache_hits
+    outputs = none
+  []
+[]
+
+[UserObjects]
+  [no_cache_hits]
+    type = Terminator
+    expression = 'total_cache_hits < 1'
+    fail_mode = HARD
+    error_level = ERROR
+    message = 'The return mapping cache was never hit'
+    execute_on = FINAL
+  []
+[]
@@ -0,0 +1,100 @@
+# Single element under a constant uniaxial stress of 100 creeping by the Arrhenius power law creep
+# of CompositeViscoplasticityStressUpdate, without a yield stress or a hardening function. The
+# creep strain grows at the constant rate A exp(-Q / (R T)) 100^n = 2.955764e-3, so the gold is
+# the analytical solution.
+
+[GlobalParams]
+  displacements = 'disp_x disp_y disp_z'
+[]
+
+[Mesh]
+  [cube]
+    type = GeneratedMeshGenerator
+    dim = 3
+  []
+[]
+
+[AuxVariables]
+  [temperature]
+    initial_condition = 800
+  []
+[]
+
+[Physics/SolidMechanics/QuasiStatic]
+  [all]
+    strain = SMALL
+    incremental = true
+    add_variables = true
+    generate_output = 'stress_xx'
+  []
+[]
+
+[BCs]
+  [fix_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = left
+    value = 0
+  []
+  [fix_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = bottom
+    value = 0
+  []
+  [fix_z]
+    type = DirichletBC
+    variable = disp_z
+    boundary = back
+    value = 0
+  []
+  [load]
+    type = NeumannBC
+    variable = disp_x
+    boundary = right
+    value = 100
+  []
+[]
+
+[Materials]
+  [elasticity_tensor]
+    type = ComputeIsotropicElasticityTensor
+    youngs_modulus = 2e5
+    poissons_ratio = 0.3
+  []
+  [stress]
+    type = ComputeMultipleInelasticStress
+    inelastic_models = creep
+  []
+  [creep]
+    type = CompositeViscoplasticityStressUpdate
+    creep_coefficient = 1e-6
+    creep_exponent = 5
+    creep_activation_energy = 1e5
+    temperature = temperature
+  []
+[]
+
+[Postprocessors]
+  [stress_xx]
+    type = ElementAverageValue
+    variable = stress_xx
+  []
+  [effective_creep_strain]
+    type = ElementAverageMaterialProperty
+    mat_prop = effective_creep_strain
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  nl_rel_tol = 1e-12
+  nl_abs_tol = 1e-10
+  dt = 0.5
+  end_time = 2
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,54 @@
+# PerzynaViscoplasticityStressUpdateFunction with a fractional exponent, whose rate is NaN below the
+# flow stress, on both blocks. The tests switch the integration options of the test block, which
+# must reproduce the default path of the reference block.
+!include uniaxial_common.i
+
+[Physics/SolidMechanics/QuasiStatic]
+  [all]
+    strain = SMALL
+    incremental = true
+    add_variables = true
+    generate_output = 'stress_xx'
+  []
+[]
+
+[Functions]
+  [voce]
+    type = ParsedFunction
+    expression = '100 * (1 - exp(-20 * t)) + 50 * t'
+  []
+[]
+
+[Materials]
+  [elasticity_tensor]
+    type = ComputeIsotropicElasticityTensor
+    youngs_modulus = 2e5
+    poissons_ratio = 0.3
+  []
+  [stress_reference]
+    type = ComputeMultipleInelasticStress
+    inelastic_models = reference
+    block = reference
+  []
+  [reference]
+    type = PerzynaViscoplasticityStressUpdateFunction
+    yield_stress = 150
+    hardening_function = voce
+    n = 2.5
+    eta = 1e-3
+    block = reference
+  []
+  [stress]
+    type = ComputeMultipleInelasticStress
+    inelastic_models = viscoplasticity
+    block = test
+  []
+  [viscoplasticity]
+    type = PerzynaViscoplasticityStressUpdateFunction
+    yield_stress = 150
+    hardening_function = voce
+    n = 2.5
+    eta = 1e-3
+    block = test
+  []
+[]
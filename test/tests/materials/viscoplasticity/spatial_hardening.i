@@ -0,0 +1,58 @@
+# SinhViscoplasticityStressUpdate with a hardening function that is the Voce curve on the test block
+# and zero elsewhere, in particular at the origin. The run fails unless the function is evaluated
+# at the quadrature points, where it matches the Voce curve of the reference block.
+!include uniaxial_common.i
+
+[Physics/SolidMechanics/QuasiStatic]
+  [all]
+    strain = SMALL
+    incremental = true
+    add_variables = true
+    generate_output = 'stress_xx'
+  []
+[]
+
+[Functions]
+  [voce]
+    type = ParsedFunction
+    expression = '100 * (1 - exp(-20 * t)) + 50 * t'
+  []
+  [voce_on_test_block]
+    type = ParsedFunction
+    expression = 'if(x > 1.5, 100 * (1 - exp(-20 * t)) + 50 * t, 0)'
+  []
+[]
+
+[Materials]
+  [elasticity_tensor]
+    type = ComputeIsotropicElasticityTensor
+    youngs_modulus = 2e5
+    poissons_ratio = 0.3
+  []
+  [stress_reference]
+    type = ComputeMultipleInelasticStress
+    inelastic_models = reference
+    block = reference
+  []
+  [reference]
+    type = SinhViscoplasticityStressUpdate
+    yield_stress = 150
+    hardening_function = voce
+    alpha = 1e-5
+    beta = 0.05
+    block = reference
+  []
+  [stress]
+    type = ComputeMultipleInelasticStress
+    inelastic_models = viscoplasticity
+    block = test
+  []
+  [viscoplasticity]
+    type = SinhViscoplasticityStressUpdate
+    yield_stress = 150
+    hardening_function = voce_on_test_block
+    alpha = 1e-5
+    beta = 0.05
+    block = test
+  []
+[]
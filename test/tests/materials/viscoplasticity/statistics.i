@@ -0,0 +1,53 @@
+# uniaxial.i with the return mapping statistics, the run fails unless they count the plastic
+# points of the pull and no failed solve
+!include uniaxial.i
+
+[Materials]
+  [viscoplasticity]
+    return_mapping_statistics = statistics
+  []
+[]
+
+[VectorPostprocessors]
+  [statistics]
+    type = ReturnMappingStatistics
+  []
+[]
+
+[Postprocessors]
+  [plastic_points]
+    type = VectorPostprocessorComponent
+    vectorpostprocessor = statistics
+    vector_name = plastic_points
+    index = 0
+    outputs = none
+  []
+  [failures]
+    type = VectorPostprocessorComponent
+    vectorpostprocessor = statistics
+    vector_name = failures
+    index = 0
+    outputs = none
+  []
+  [total_plastic_points]
+    type = CumulativeValuePostprocessor
+    postprocessor = plastic_points
+    outputs = none
+  []
+  [total_failures]
+    type = CumulativeValuePostprocessor
+    postprocessor = failures
+    outputs = none
+  []
+[]
+
+[UserObjects]
+  [statistics_check]
+    type = Terminator
+    expression = 'total_plastic_points < 1 | total_failures > 0'
+    fail_mode = HARD
+    error_level = ERROR
+    message = 'The return mapping statistics missed the plastic points or recorded a failure'
+    execute_on = FINAL
+  []
+[]
@@ -0,0 +1,61 @@
+# HSVStressUpdate under uniaxial stress on the test block against SinhViscoplasticityStressUpdate
+# with the same Voce curve as a hardening function on the reference block. The tests switch the
+# integration options of the test block, which must reproduce the default path.
+!include uniaxial_common.i
+
+[Physics/SolidMechanics/QuasiStatic]
+  [all]
+    strain = SMALL
+    incremental = true
+    add_variables = true
+    generate_output = 'stress_xx'
+  []
+[]
+
+[Functions]
+  [voce]
+    type = ParsedFunction
+    expression = '100 * (1 - exp(-20 * t)) + 50 * t'
+  []
+[]
+
+[Materials]
+  [parameters]
+    type = GenericConstantMaterial
+    prop_names = 'yield_stress sat_stress exp_rate lin_rate c_alpha c_beta'
+    prop_values = '150 100 20 50 1e-5 0.05'
+  []
+  [elasticity_tensor]
+    type = ComputeIsotropicElasticityTensor
+    youngs_modulus = 2e5
+    poissons_ratio = 0.3
+  []
+  [stress_reference]
+    type = ComputeMultipleInelasticStress
+    inelastic_models = reference
+    block = reference
+  []
+  [reference]
+    type = SinhViscoplasticityStressUpdate
+    yield_stress = 150
+    hardening_function = voce
+    alpha = 1e-5
+    beta = 0.05
+    block = reference
+  []
+  [stress]
+    type = ComputeMultipleInelasticStress
+    inelastic_models = viscoplasticity
+    block = test
+  []
+  [viscoplasticity]
+    type = HSVStressUpdate
+    yield_stress = yield_stress
+    sat_stress = sat_stress
+    exp_rate = exp_rate
+    lin_rate = lin_rate
+    c_alpha = c_alpha
+    c_beta = c_beta
+    block = test
+  []
+[]
@@ -0,0 +1,124 @@
+# Two separate single elements pulled at the same constant strain rate under uniaxial stress,
+# shared by the inputs that check the integration options of the viscoplastic stress updates. The
+# reference block runs the default path and the test block the options under test. The run fails
+# as soon as the stress or the effective plastic strain of the two blocks differ by more than the
+# tolerance of the mismatch Terminator, so no gold file is involved.
+
+[GlobalParams]
+  displacements = 'disp_x disp_y disp_z'
+[]
+
+[Mesh]
+  [reference_cube]
+    type = GeneratedMeshGenerator
+    dim = 3
+  []
+  [test_cube]
+    type = GeneratedMeshGenerator
+    dim = 3
+  []
+  [test_block]
+    type = SubdomainIDGenerator
+    input = test_cube
+    subdomain_id = 1
+  []
+  [combined]
+    type = CombinerGenerator
+    inputs = 'reference_cube test_block'
+    positions = '0 0 0 2 0 0'
+  []
+  [names]
+    type = RenameBlockGenerator
+    input = combined
+    old_block = '0 1'
+    new_block = 'reference test'
+  []
+[]
+
+[Functions]
+  [pull]
+    type = ParsedFunction
+    expression = '2e-3 * t'
+  []
+[]
+
+[BCs]
+  [fix_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = left
+    value = 0
+  []
+  [fix_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = bottom
+    value = 0
+  []
+  [fix_z]
+    type = DirichletBC
+    variable = disp_z
+    boundary = back
+    value = 0
+  []
+  [pull]
+    type = FunctionDirichletBC
+    variable = disp_x
+    boundary = right
+    function = pull
+  []
+[]
+
+[Postprocessors]
+  [stress_xx_reference]
+    type = ElementAverageValue
+    variable = stress_xx
+    block = reference
+  []
+  [stress_xx]
+    type = ElementAverageValue
+    variable = stress_xx
+    block = test
+  []
+  [effective_plastic_strain_reference]
+    type = ElementAverageMaterialProperty
+    mat_prop = effective_plastic_strain
+    block = reference
+  []
+  [effective_plastic_strain]
+    type = ElementAverageMaterialProperty
+    mat_prop = effective_plastic_strain
+    block = test
+  []
+  [difference]
+    type = ParsedPostprocessor
+    expression = 'max(abs(stress_xx - stress_xx_reference) / max(abs(stress_xx_reference), 1), '
+                 'abs(effective_plastic_strain - effective_plastic_strain_reference) / '
+                 'max(effective_plastic_strain_reference, 1e-6))'
+    pp_names = 'stress_xx stress_xx_reference effective_plastic_strain '
+               'effective_plastic_strain_reference'
+  []
+[]
+
+[UserObjects]
+  [mismatch]
+    type = Terminator
+    expression = 'difference > 1e-6'
+    fail_mode = HARD
+    error_level = ERROR
+    message = 'The test block departs from the reference block'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  nl_rel_tol = 1e-10
+  nl_abs_tol = 1e-10
+  dt = 0.25
+  end_time = 5
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,16 @@
+# CompositeViscoplasticityStressUpdate with a hyperbolic sine law and power law creep, solved in a
+# single return mapping
+!include scaling_common.i
+
+[Materials]
+  [viscoplasticity]
+    type = CompositeViscoplasticityStressUpdate
+    yield_stress = 150
+    sinh_alpha = 1e-5
+    sinh_beta = 0.05
+    creep_coefficient = 1e-20
+    creep_exponent = 5
+    hardening_function = hardening
+    tabulate_hardening_function = true
+  []
+[]
@@ -0,0 +1,25 @@
+# HSVStressUpdate combined with Kachanov-Rabotnov creep damage
+!include scaling_common.i
+
+[Materials]
+  [stress]
+    damage_model = damage
+  []
+  [damage]
+    type = KRDamage
+    a = 400
+    phi = 3
+    zeta = 4
+  []
+  [viscoplasticity]
+    type = HSVStressUpdate
+    temperature = temperature
+    table_temperatures = '300 500 700'
+    table_yield_stress = '150 120 80'
+    table_sat_stress = '100 80 50'
+    table_exp_rate = '20 20 20'
+    table_lin_rate = '50 40 20'
+    table_c_alpha = '1e-5 1e-4 1e-3'
+    table_c_beta = '0.05 0.06 0.08'
+  []
+[]
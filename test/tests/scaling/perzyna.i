@@ -0,0 +1,13 @@
+# PerzynaViscoplasticityStressUpdateFunction with a tabulated hardening function
+!include scaling_common.i
+
+[Materials]
+  [viscoplasticity]
+    type = PerzynaViscoplasticityStressUpdateFunction
+    yield_stress = 150
+    n = 4
+    eta = 1e-3
+    hardening_function = hardening
+    tabulate_hardening_function = true
+  []
+[]
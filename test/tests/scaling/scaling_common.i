@@ -0,0 +1,159 @@
+# Mesh, physics, elastic and thermal materials, loading and outputs shared by the viscoplastic
+# scaling inputs, each of which adds its inelastic model named viscoplasticity. The mesh refinement
+# and the simulated time are set from the command line, e.g. 'n=32 end_time=10'.
+n = 8
+end_time = 5
+
+[GlobalParams]
+  displacements = 'disp_x disp_y disp_z'
+[]
+
+[Mesh]
+  [cube]
+    type = GeneratedMeshGenerator
+    dim = 3
+    nx = ${n}
+    ny = ${n}
+    nz = ${n}
+  []
+[]
+
+[Variables]
+  [temperature]
+    initial_condition = 300
+  []
+[]
+
+[Kernels]
+  [heat_conduction]
+    type = HeatConduction
+    variable = temperature
+  []
+  [heat_time_derivative]
+    type = HeatConductionTimeDerivative
+    variable = temperature
+  []
+[]
+
+[Physics/SolidMechanics/QuasiStatic]
+  [all]
+    strain = FINITE
+    add_variables = true
+    eigenstrain_names = thermal_eigenstrain
+    generate_output = 'vonmises_stress'
+  []
+[]
+
+[Materials]
+  [elasticity_tensor]
+    type = ComputeIsotropicElasticityTensor
+    youngs_modulus = 2e5
+    poissons_ratio = 0.3
+  []
+  [thermal_expansion]
+    type = ComputeThermalExpansionEigenstrain
+    temperature = temperature
+    thermal_expansion_coeff = 1e-5
+    stress_free_temperature = 300
+    eigenstrain_name = thermal_eigenstrain
+  []
+  [heat_conduction]
+    type = HeatConductionMaterial
+    thermal_conductivity = 45
+    specific_heat = 0.5
+  []
+  [density]
+    type = GenericConstantMaterial
+    prop_names = density
+    prop_values = 7.8
+  []
+  [stress]
+    type = ComputeMultipleInelasticStress
+    inelastic_models = viscoplasticity
+  []
+[]
+
+[Functions]
+  [pull]
+    type = ParsedFunction
+    expression = '2e-3 * t'
+  []
+  [heating]
+    type = ParsedFunction
+    expression = '300 + 40 * t'
+  []
+  [hardening]
+    type = ParsedFunction
+    expression = '100 * (1 - exp(-20 * t)) + 50 * t'
+  []
+[]
+
+[BCs]
+  [fix_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = left
+    value = 0
+  []
+  [fix_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = bottom
+    value = 0
+  []
+  [fix_z]
+    type = DirichletBC
+    variable = disp_z
+    boundary = back
+    value = 0
+  []
+  [pull]
+    type = FunctionDirichletBC
+    variable = disp_x
+    boundary = right
+    function = pull
+  []
+  [heating]
+    type = FunctionDirichletBC
+    variable = temperature
+    boundary = left
+    function = heating
+  []
+[]
+
+[Postprocessors]
+  [max_vonmises_stress]
+    type = ElementExtremeValue
+    variable = vonmises_stress
+  []
+  [effective_plastic_strain]
+    type = ElementAverageMaterialProperty
+    mat_prop = effective_plastic_strain
+  []
+[]
+
+[Reporters]
+  [perf_graph]
+    type = PerfGraphReporter
+    execute_on = FINAL
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+  nl_rel_tol = 1e-8
+  nl_abs_tol = 1e-8
+  dt = 0.5
+  end_time = ${end_time}
+[]
+
+[Outputs]
+  [timing]
+    type = JSON
+    execute_on = FINAL
+    execute_system_information_on = NONE
+  []
+[]
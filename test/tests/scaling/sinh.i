@@ -0,0 +1,13 @@
+# SinhViscoplasticityStressUpdate with a tabulated hardening function
+!include scaling_common.i
+
+[Materials]
+  [viscoplasticity]
+    type = SinhViscoplasticityStressUpdate
+    yield_stress = 150
+    alpha = 1e-5
+    beta = 0.05
+    hardening_function = hardening
+    tabulate_hardening_function = true
+  []
+[]